@@ -0,0 +1,390 @@
+#include "BitBoard.hpp"
+#include <algorithm>
+#include <utility>
+
+// Constructor que carga las pistas del tablero y construye las máscaras de cada unidad
+template <int BOX>
+BasicBitBoard<BOX>::BasicBitBoard(const SudokuBoard& board)
+    : _BOARD_SIZE(board.get_board_size())
+{
+    const int N = _BOARD_SIZE;
+    const int B = board.get_box_size();
+    if constexpr (FIXED)
+    {
+        if (N != FIXED_SIZE) { _consistent = false; return; }
+    }
+    else
+    {
+        // Sin tablas de fila/columna/caja si las cajas no cubren el tablero exactamente
+        if (N <= 0 || N > MAX_BOARD_SIZE || B * B != N) { _consistent = false; return; }
+        _table = &PeerTable::get(B);
+        _cells.assign(N * N, 0);
+        _rowMask.assign(N, 0);
+        _colMask.assign(N, 0);
+        _boxMask.assign(N, 0);
+        _empty.assign(N * N, 0);
+    }
+    _full = (N == 8 * (int)sizeof(Mask)) ? ~Mask(0) : ((Mask(1) << N) - 1);
+
+    for (int cell = 0; cell < N * N; ++cell)
+    {
+        int num = board.at(cell);
+        if (num == board.get_empty_cell_value())
+        {
+            _empty[_numEmpty++] = (std::uint16_t)cell;
+            continue;
+        }
+        // Una pista fuera de rango o repetida en su unidad hace que el tablero no tenga solución
+        if (num < board.get_min_value() || num > board.get_max_value())
+        {
+            _consistent = false;
+            continue;
+        }
+        if (!(candidates(cell) & (Mask(1) << (num - 1)))) { _consistent = false; }
+        place(cell, num);
+    }
+    _initialEmpty = _numEmpty;
+}
+
+// Elige la celda vacía con menos candidatos y la mueve al final de la zona de vacías
+template <int BOX>
+int BasicBitBoard<BOX>::take_cell(Mask& cellCandidates)
+{
+    int bestIndex = 0;
+    int bestCount = get_board_size() + 1;
+    for (int i = 0; i < _numEmpty; ++i)
+    {
+        Mask m = candidates(_empty[i]);
+        int count = popcount(m);
+        if (count < bestCount)
+        {
+            bestCount = count;
+            bestIndex = i;
+            cellCandidates = m;
+            if (count <= 1) { break; }   // Celda forzada o sin salida: no se puede mejorar
+        }
+    }
+
+    std::swap(_empty[bestIndex], _empty[_numEmpty - 1]);
+    --_numEmpty;
+    return _empty[_numEmpty];
+}
+
+// Sustituye el orden de la lista de vacías si es una permutación de las mismas celdas
+template <int BOX>
+bool BasicBitBoard<BOX>::set_empty_order(const std::vector<int>& order)
+{
+    if (_numEmpty != _initialEmpty || (int)order.size() != _initialEmpty) { return false; }
+    std::vector<int> current = get_empty_order(), wanted(order);
+    std::sort(current.begin(), current.end());
+    std::sort(wanted.begin(), wanted.end());
+    if (current != wanted) { return false; }
+    std::copy(order.begin(), order.end(), _empty.begin());
+    return true;
+}
+
+// Backtracking con la heurística MRV y una pila explícita de puntos de elección: devuelve true y deja el
+// tablero completo si hay solución. Un nodo rechazado por el presupuesto cuenta como rama sin salida, igual
+// que si la llamada recursiva hubiera devuelto false.
+template <int BOX>
+bool BasicBitBoard<BOX>::solve()
+{
+    if (!_consistent) { return false; }
+
+    Storage<Frame, FIXED_CELLS + 1> stack;
+    if constexpr (!FIXED) { stack.resize(_numEmpty + 1); }
+    int top = 0;   // Niveles en la pila
+
+    // Visita el nodo actual: true si es una solución; si hay que ramificar, apila su celda
+    auto visit = [&]() {
+        if (_budget != nullptr && _budget->charge()) { return false; }   // Límite de tiempo, nodos o memoria
+        int depth = _initialEmpty - _numEmpty;   // Celdas rellenadas por la búsqueda
+        _stats.node(depth);
+        if (_numEmpty == 0) { return true; }
+
+        Mask cellCandidates = 0;
+        int cell = take_cell(cellCandidates);
+        _stats.branch(depth, popcount(cellCandidates));
+        stack[top++] = Frame{ cell, 0, cellCandidates, 0 };
+        return false;
+    };
+
+    if (visit()) { return true; }
+    while (top > 0)
+    {
+        Frame& frame = stack[top - 1];
+        if (frame.num != 0)   // El hijo anterior no llevó a ninguna solución
+        {
+            remove(frame.cell, frame.num);
+            _stats.backtrack();
+            frame.num = 0;
+        }
+        if (!frame.remaining)   // Sin candidatos: la celda vuelve a la lista y se sube un nivel
+        {
+            restore_cell();
+            --top;
+            continue;
+        }
+
+        Mask bit = frame.remaining & (~frame.remaining + 1);   // Bit menos significativo
+        frame.remaining ^= bit;
+        frame.num = lowest(bit) + 1;
+        place(frame.cell, frame.num);
+        if (visit()) { return true; }
+    }
+    return false;
+}
+
+// Singles desnudos: una celda con un solo candidato. Singles ocultos: un número que solo cabe en una celda de
+// una fila, columna o caja; once y twice marcan los números que aparecen como candidatos al menos una y al
+// menos dos veces en cada unidad. Las máscaras se calculan al principio de cada pasada, pero los candidatos de
+// cada celda se vuelven a leer al rellenarla, así que una asignación nunca choca con otra de la misma pasada.
+template <int BOX>
+bool BasicBitBoard<BOX>::propagate(int& forced, Mask* once, Mask* twice)
+{
+    const int N = get_board_size();
+
+    // Saca de la zona de vacías la celda en la posición i tras rellenarla
+    auto fill = [&](int i, int num) {
+        place(_empty[i], num);
+        std::swap(_empty[i], _empty[_numEmpty - 1]);
+        --_numEmpty;
+        ++forced;
+    };
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (int i = 0; i < _numEmpty; )
+        {
+            Mask m = candidates(_empty[i]);
+            if (!m) { return false; }
+            if (m & (m - 1)) { ++i; continue; }
+            fill(i, lowest(m) + 1);   // La celda que ocupa ahora la posición i se revisa en la siguiente vuelta
+            changed = true;
+        }
+        if (_numEmpty == 0) { return true; }
+
+        std::fill(once, once + 3 * N, Mask(0));
+        std::fill(twice, twice + 3 * N, Mask(0));
+        for (int i = 0; i < _numEmpty; ++i)
+        {
+            int cell = _empty[i];
+            Mask m = candidates(cell);
+            int units[3] = { row_of(cell), N + col_of(cell), 2 * N + box_of(cell) };
+            for (int u : units)
+            {
+                twice[u] |= once[u] & m;
+                once[u] |= m;
+            }
+        }
+        for (int u = 0; u < N; ++u)   // Un número que falta en una unidad y no cabe en ninguna de sus celdas
+        {
+            if ((_rowMask[u] | once[u]) != _full || (_colMask[u] | once[N + u]) != _full
+                || (_boxMask[u] | once[2 * N + u]) != _full) { return false; }
+        }
+
+        for (int i = 0; i < _numEmpty; )
+        {
+            int cell = _empty[i];
+            int r = row_of(cell), c = N + col_of(cell), b = 2 * N + box_of(cell);
+            Mask hidden = candidates(cell)
+                & ((once[r] & ~twice[r]) | (once[c] & ~twice[c]) | (once[b] & ~twice[b]));
+            if (!hidden) { ++i; continue; }
+            if (hidden & (hidden - 1)) { return false; }   // Dos números que solo caben en la misma celda
+            fill(i, lowest(hidden) + 1);
+            changed = true;
+        }
+    }
+    return true;
+}
+
+template <int BOX>
+void BasicBitBoard<BOX>::unforce(int& forced, int mark)
+{
+    for (; forced > mark; --forced)
+    {
+        int cell = _empty[_numEmpty++];
+        remove(cell, _cells[cell]);
+    }
+}
+
+// Cuenta las soluciones hasta limit con una pila explícita como solve(), sin estadísticas, y propagando los
+// singles tras cada asignación. Si se agota el presupuesto la pila se vacía como al llegar a limit. Las celdas tomadas y las forzadas salen de la zona de vacías en
+// orden y vuelven en el inverso, así que al terminar el tablero tiene las mismas celdas vacías que al empezar.
+template <int BOX>
+int BasicBitBoard<BOX>::count_solutions(int limit /*=2*/)
+{
+    if (!_consistent || limit <= 0) { return 0; }
+    if (_numEmpty == 0) { return 1; }
+
+    Storage<Frame, FIXED_CELLS + 1> stack;
+    Storage<Mask, 3 * FIXED_SIZE> once, twice;
+    if constexpr (!FIXED)
+    {
+        stack.resize(_numEmpty + 1);
+        once.resize(3 * get_board_size());
+        twice.resize(3 * get_board_size());
+    }
+    int top = 0;
+    int count = 0;
+    int forced = 0;   // Celdas rellenadas por la propagación que siguen en el tablero
+
+    Mask cellCandidates = 0;
+    if (propagate(forced, once.data(), twice.data()))
+    {
+        if (_numEmpty == 0) { count = 1; }
+        else
+        {
+            int cell = take_cell(cellCandidates);
+            stack[top++] = Frame{ cell, 0, cellCandidates, forced };
+        }
+    }
+    while (top > 0)
+    {
+        Frame& frame = stack[top - 1];
+        if (frame.num != 0)
+        {
+            unforce(forced, frame.forced);
+            remove(frame.cell, frame.num);
+            frame.num = 0;
+        }
+        if (!frame.remaining || count >= limit || (_budget != nullptr && _budget->charge()))
+        {
+            restore_cell();
+            --top;
+            continue;
+        }
+
+        Mask bit = frame.remaining & (~frame.remaining + 1);
+        frame.remaining ^= bit;
+        frame.num = lowest(bit) + 1;
+        place(frame.cell, frame.num);
+
+        if (!propagate(forced, once.data(), twice.data())) { continue; }
+        if (_numEmpty == 0) { ++count; continue; }
+        int cell = take_cell(cellCandidates);
+        stack[top++] = Frame{ cell, 0, cellCandidates, forced };
+    }
+    unforce(forced, 0);
+    return (count < limit) ? count : limit;
+}
+
+// Relleno aleatorio con la misma pila y la misma propagación que count_solutions(): en cada punto de elección
+// se sortea cuál de los candidatos que quedan se prueba. Al agotar max_nodes la pila se vacía deshaciendo las
+// asignaciones como si no quedaran candidatos.
+template <int BOX>
+bool BasicBitBoard<BOX>::fill_random(std::mt19937& rng, long long max_nodes)
+{
+    if (!_consistent) { return false; }
+
+    Storage<Frame, FIXED_CELLS + 1> stack;
+    Storage<Mask, 3 * FIXED_SIZE> once, twice;
+    if constexpr (!FIXED)
+    {
+        stack.resize(_numEmpty + 1);
+        once.resize(3 * get_board_size());
+        twice.resize(3 * get_board_size());
+    }
+    int top = 0;
+    int forced = 0;
+    long long nodes = 0;
+
+    Mask cellCandidates = 0;
+    if (!propagate(forced, once.data(), twice.data()))
+    {
+        unforce(forced, 0);
+        return false;
+    }
+    if (_numEmpty == 0) { return true; }
+    int cell = take_cell(cellCandidates);
+    stack[top++] = Frame{ cell, 0, cellCandidates, forced };
+
+    while (top > 0)
+    {
+        Frame& frame = stack[top - 1];
+        if (frame.num != 0)
+        {
+            unforce(forced, frame.forced);
+            remove(frame.cell, frame.num);
+            frame.num = 0;
+        }
+        if (!frame.remaining || nodes >= max_nodes)
+        {
+            restore_cell();
+            --top;
+            continue;
+        }
+
+        // Candidato k-ésimo de los que quedan, con k al azar
+        int k = std::uniform_int_distribution<int>(0, popcount(frame.remaining) - 1)(rng);
+        Mask rest = frame.remaining;
+        for (; k > 0; --k) { rest &= rest - 1; }
+        Mask bit = rest & (~rest + 1);
+        frame.remaining ^= bit;
+        frame.num = lowest(bit) + 1;
+        place(frame.cell, frame.num);
+        ++nodes;
+
+        if (!propagate(forced, once.data(), twice.data())) { continue; }
+        if (_numEmpty == 0) { return true; }
+        cell = take_cell(cellCandidates);
+        stack[top++] = Frame{ cell, 0, cellCandidates, forced };
+    }
+    unforce(forced, 0);
+    return false;
+}
+
+// Ramifica la celda con menos candidatos en un tablero hijo por candidato
+template <int BOX>
+void BasicBitBoard<BOX>::branch(std::vector<BasicBitBoard>& children) const
+{
+    if (!_consistent || _numEmpty == 0) { return; }
+
+    BasicBitBoard parent(*this);
+    Mask cellCandidates = 0;
+    int cell = parent.take_cell(cellCandidates);
+    while (cellCandidates)
+    {
+        Mask bit = cellCandidates & (~cellCandidates + 1);
+        cellCandidates ^= bit;
+
+        children.push_back(parent);
+        children.back()._stats.clear();
+        children.back().place(cell, lowest(bit) + 1);
+    }
+}
+
+// Copia los valores de las celdas al tablero
+template <int BOX>
+void BasicBitBoard<BOX>::write_to(SudokuBoard& board) const
+{
+    const int N = get_board_size();
+    for (int cell = 0; cell < N * N; ++cell) { board.set_cell(cell, _cells[cell]); }
+}
+
+template class BasicBitBoard<0>;
+template class BasicBitBoard<2>;
+template class BasicBitBoard<3>;
+template class BasicBitBoard<4>;
+template class BasicBitBoard<5>;
+template class BasicBitBoard<6>;
+
+// Construye la versión del tamaño de caja del tablero
+AnyBitBoard make_bitboard(const SudokuBoard& board)
+{
+    if (board.get_box_size() * board.get_box_size() == board.get_board_size())
+    {
+        switch (board.get_box_size())
+        {
+            case 2: return AnyBitBoard(std::in_place_type<BasicBitBoard<2>>, board);
+            case 3: return AnyBitBoard(std::in_place_type<BasicBitBoard<3>>, board);
+            case 4: return AnyBitBoard(std::in_place_type<BasicBitBoard<4>>, board);
+            case 5: return AnyBitBoard(std::in_place_type<BasicBitBoard<5>>, board);
+            case 6: return AnyBitBoard(std::in_place_type<BasicBitBoard<6>>, board);
+            default: break;
+        }
+    }
+    return AnyBitBoard(std::in_place_type<BitBoard>, board);
+}
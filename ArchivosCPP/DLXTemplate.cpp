@@ -0,0 +1,415 @@
+#include "DLXTemplate.hpp"
+#include "FileUtils.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+
+// Cabecera del archivo de caché; el bloque de enlaces empieza justo después (alineado a 8 bytes)
+struct DLXFileHeader {
+    char magic[4];                // "DLXT"
+    std::uint32_t version;        // DLXTemplate::FILE_VERSION
+    std::uint32_t byteOrder;      // BYTE_ORDER_MARK escrito con el orden de bytes de la máquina
+    std::uint32_t intSize;        // sizeof(int)
+    std::uint32_t boardSize;      // Tamaño del tablero
+    std::uint32_t numberOfNodes;  // Número de nodos de la lista
+    std::uint64_t numberOfInts;   // Número de enteros del bloque de enlaces
+};
+
+static_assert(sizeof(DLXFileHeader) == 32, "La cabecera debe mantener alineado el bloque de enlaces");
+
+const char FILE_MAGIC[4] = { 'D', 'L', 'X', 'T' };
+const std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+}
+
+// Calcula las dimensiones de la lista DLX para un tablero de tamaño boardSize
+void DLXTemplate::set_dimensions(int boardSize)
+{
+    _BOARD_SIZE = boardSize;
+    _BOX_SIZE = (int) std::sqrt(boardSize);
+    _numberOfColumns = _BOARD_SIZE * _BOARD_SIZE * 4;
+    _numberOfRows = _BOARD_SIZE * _BOARD_SIZE * _BOARD_SIZE;
+    _numberOfNodes = 1 + _numberOfColumns + NODES_PER_ROW * _numberOfRows;
+    _size = (std::size_t) _numberOfNodes * 5 + _numberOfColumns + 1;
+}
+
+// Constructor que construye la lista DLX completa directamente en forma dispersa:
+// cada fila (fila, columna, número) tiene exactamente un 1 en cada una de las 4 restricciones,
+// así que no hace falta generar la matriz de cobertura densa.
+DLXTemplate::DLXTemplate(int boardSize)
+{
+    set_dimensions(boardSize);
+    const int N = _BOARD_SIZE;
+    const int B = _BOX_SIZE;
+
+    _links.assign(_size, 0);
+    _data = _links.data();
+    int* L = _links.data() + offset_L();
+    int* R = _links.data() + offset_R();
+    int* U = _links.data() + offset_U();
+    int* D = _links.data() + offset_D();
+    int* C = _links.data() + offset_C();
+    int* S = _links.data() + offset_S();
+
+    // Cabecera y nodos columna enlazados en una lista circular horizontal
+    for (int c = 0; c <= _numberOfColumns; ++c)
+    {
+        L[c] = (c == 0) ? _numberOfColumns : c - 1;
+        R[c] = (c == _numberOfColumns) ? 0 : c + 1;
+        U[c] = c;
+        D[c] = c;
+        C[c] = c;
+        S[c] = 0;
+    }
+
+    // Nodos de cada fila de la matriz de cobertura, ordenadas por fila, columna y número
+    int node = get_first_row_node();
+    for (int row = 0; row < N; ++row)
+    {
+        for (int col = 0; col < N; ++col)
+        {
+            int box = (row / B) * B + (col / B);
+            for (int n = 0; n < N; ++n)
+            {
+                // Cabeceras de celda, fila, columna y caja, en ese orden
+                int columns[NODES_PER_ROW] = {
+                    1 + row * N + col,
+                    1 + N * N + row * N + n,
+                    1 + 2 * N * N + col * N + n,
+                    1 + 3 * N * N + box * N + n
+                };
+
+                for (int k = 0; k < NODES_PER_ROW; ++k, ++node)
+                {
+                    int c = columns[k];
+                    C[node] = c;
+
+                    // Enlazar hacia abajo al final de la columna
+                    U[node] = U[c];
+                    D[node] = c;
+                    D[U[c]] = node;
+                    U[c] = node;
+                    S[c]++;
+
+                    // Enlazar a la derecha dentro de la fila (lista circular de 4 nodos)
+                    int first = node - k;
+                    L[node] = (k == 0) ? first + NODES_PER_ROW - 1 : node - 1;
+                    R[node] = (k == NODES_PER_ROW - 1) ? first : node + 1;
+                }
+            }
+        }
+    }
+}
+
+// Destructor: libera la proyección del archivo de caché si la hay
+DLXTemplate::~DLXTemplate()
+{
+    if (_mappedAddress == nullptr) { return; }
+#ifdef _WIN32
+    UnmapViewOfFile(_mappedAddress);
+    CloseHandle((HANDLE) _mappingHandle);
+#else
+    munmap(_mappedAddress, _mappedLength);
+#endif
+}
+
+// Devuelve la plantilla en caché para el tamaño de tablero dado (se construye una sola vez por proceso)
+const DLXTemplate& DLXTemplate::get(int boardSize)
+{
+    static std::mutex cacheMutex;
+    static std::map<int, std::unique_ptr<DLXTemplate>> cache;
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    std::unique_ptr<DLXTemplate>& entry = cache[boardSize];
+    if (!entry)
+    {
+        if (boardSize >= DISK_CACHE_MIN_BOARD_SIZE)
+        {
+            // Tableros grandes: proyectar la plantilla guardada por una ejecución anterior, o guardarla ahora
+            std::string filename = cache_file_name(boardSize);
+            entry = load(filename, boardSize);
+            if (!entry)
+            {
+                entry.reset(new DLXTemplate(boardSize));
+                entry->save(filename);
+            }
+        }
+        else
+        {
+            entry.reset(new DLXTemplate(boardSize));
+        }
+    }
+    return *entry;
+}
+
+// Directorio de la caché en disco
+std::string DLXTemplate::cache_directory()
+{
+    const char* dir = std::getenv("SUDOKU_DLX_CACHE_DIR");
+    return (dir != nullptr && dir[0] != '\0') ? std::string(dir) : std::string(".");
+}
+
+// Nombre del archivo de caché para un tamaño de tablero (incluye la versión del formato)
+std::string DLXTemplate::cache_file_name(int boardSize)
+{
+    return cache_directory() + "/dlx_" + std::to_string(boardSize) + "_v" + std::to_string(FILE_VERSION) + ".bin";
+}
+
+// Escribe la cabecera y el bloque de enlaces. Se escribe en un archivo temporal y luego se renombra,
+// para que un proceso concurrente nunca proyecte un archivo a medio escribir.
+bool DLXTemplate::save(const std::string& filename) const
+{
+    DLXFileHeader header;
+    std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.version = FILE_VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.intSize = sizeof(int);
+    header.boardSize = _BOARD_SIZE;
+    header.numberOfNodes = _numberOfNodes;
+    header.numberOfInts = _size;
+
+    std::string tmpFilename = filename + ".tmp" + std::to_string(std::random_device()());
+    {
+        std::ofstream outputFile(tmpFilename, std::ios::binary | std::ios::trunc);
+        if (!outputFile) { return false; }
+        outputFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        outputFile.write(reinterpret_cast<const char*>(_data), _size * sizeof(int));
+        if (!outputFile) { outputFile.close(); std::remove(tmpFilename.c_str()); return false; }
+    }
+
+    return replace_file(tmpFilename, filename);
+}
+
+// Proyecta el archivo de caché en memoria de solo lectura y valida su cabecera
+std::unique_ptr<DLXTemplate> DLXTemplate::load(const std::string& filename, int boardSize)
+{
+    void* address = nullptr;
+    std::size_t length = 0;
+    void* mappingHandle = nullptr;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) { return nullptr; }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < (LONGLONG) sizeof(DLXFileHeader)) { CloseHandle(file); return nullptr; }
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);   // La proyección mantiene el archivo abierto
+    if (mapping == NULL) { return nullptr; }
+    address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (address == NULL) { CloseHandle(mapping); return nullptr; }
+    length = (std::size_t) fileSize.QuadPart;
+    mappingHandle = mapping;
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) { return nullptr; }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size < (off_t) sizeof(DLXFileHeader)) { close(fd); return nullptr; }
+    length = (std::size_t) fileStat.st_size;
+    address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);   // La proyección sigue siendo válida tras cerrar el descriptor
+    if (address == MAP_FAILED) { return nullptr; }
+#endif
+
+    std::unique_ptr<DLXTemplate> dlxTemplate(new DLXTemplate());
+    dlxTemplate->_mappedAddress = address;   // A partir de aquí el destructor libera la proyección
+    dlxTemplate->_mappedLength = length;
+    dlxTemplate->_mappingHandle = mappingHandle;
+    dlxTemplate->set_dimensions(boardSize);
+
+    const DLXFileHeader* header = static_cast<const DLXFileHeader*>(address);
+    bool valid = std::memcmp(header->magic, FILE_MAGIC, sizeof(FILE_MAGIC)) == 0
+              && header->version == FILE_VERSION
+              && header->byteOrder == BYTE_ORDER_MARK
+              && header->intSize == sizeof(int)
+              && header->boardSize == (std::uint32_t) boardSize
+              && header->numberOfNodes == (std::uint32_t) dlxTemplate->_numberOfNodes
+              && header->numberOfInts == dlxTemplate->_size
+              && length == sizeof(DLXFileHeader) + dlxTemplate->_size * sizeof(int);
+    if (!valid) { return nullptr; }
+
+    dlxTemplate->_data = reinterpret_cast<const int*>(static_cast<const char*>(address) + sizeof(DLXFileHeader));
+    return dlxTemplate;
+}
+
+// Constructor que copia la plantilla
+DLXInstance::DLXInstance(const DLXTemplate& dlxTemplate)
+{
+    reset(dlxTemplate);
+}
+
+// Constructor de copia: copia el bloque de enlaces y vuelve a apuntar L/R/U/D/C/S a la nueva memoria
+DLXInstance::DLXInstance(const DLXInstance& anotherInstance)
+    : _template(anotherInstance._template),
+      _links(anotherInstance._links)
+{
+    bind();
+}
+
+// Operador de asignación de copia
+DLXInstance& DLXInstance::operator= (const DLXInstance& anotherInstance)
+{
+    if (this != &anotherInstance)
+    {
+        _template = anotherInstance._template;
+        _links.resize(anotherInstance._links.size());
+        std::memcpy(_links.data(), anotherInstance._links.data(), _links.size() * sizeof(int));
+        bind();
+    }
+    return *this;
+}
+
+// Recalcula los punteros a cada arreglo dentro del bloque de enlaces
+void DLXInstance::bind()
+{
+    if (_template == nullptr) { return; }
+    int* base = _links.data();
+    L = base + _template->offset_L();
+    R = base + _template->offset_R();
+    U = base + _template->offset_U();
+    D = base + _template->offset_D();
+    C = base + _template->offset_C();
+    S = base + _template->offset_S();
+}
+
+// Restablece la instancia copiando los enlaces de la plantilla con un único memcpy.
+// Si la plantilla está proyectada desde disco, esta copia privada es la que se modifica durante la búsqueda
+// y las páginas del archivo se comparten sin cambios entre procesos.
+void DLXInstance::reset(const DLXTemplate& dlxTemplate)
+{
+    _template = &dlxTemplate;
+    _links.resize(dlxTemplate.size());
+    std::memcpy(_links.data(), dlxTemplate.data(), dlxTemplate.size() * sizeof(int));
+    bind();
+}
+
+// Primer nodo de la fila de cobertura correspondiente a (row, col, num), con num en [1, BOARD_SIZE]
+int DLXInstance::rowNode(int row, int col, int num) const
+{
+    int N = _template->get_board_size();
+    int coverRow = (row * N + col) * N + (num - 1);
+    return _template->get_first_row_node() + coverRow * DLXTemplate::NODES_PER_ROW;
+}
+
+// Cubre las filas de las pistas: equivale a seleccionar de antemano esas filas en el Algoritmo X
+bool DLXInstance::coverGivens(const SudokuBoard& board)
+{
+    int N = _template->get_board_size();
+    if (board.get_board_size() != N) { return false; }
+
+    for (int row = 0; row < N; ++row)
+    {
+        for (int col = 0; col < N; ++col)
+        {
+            int num = board.at(row, col);
+            if (num == board.get_empty_cell_value()) { continue; }
+            if (num < board.get_min_value() || num > board.get_max_value()) { return false; }
+
+            // Si alguna de las restricciones de la pista ya está cubierta, otra pista entra en conflicto con ella
+            int first = rowNode(row, col, num);
+            for (int k = 0; k < DLXTemplate::NODES_PER_ROW; ++k)
+            {
+                if (!isActive(C[first + k])) { return false; }
+            }
+            for (int k = 0; k < DLXTemplate::NODES_PER_ROW; ++k)
+            {
+                cover(C[first + k]);
+            }
+        }
+    }
+    return true;
+}
+
+// Cubrir una columna: la quita de la cabecera y elimina todas las filas que la usan
+void DLXInstance::cover(int c)
+{
+    L[R[c]] = L[c];
+    R[L[c]] = R[c];
+    for (int i = D[c]; i != c; i = D[i])
+    {
+        for (int j = R[i]; j != i; j = R[j])
+        {
+            U[D[j]] = U[j];
+            D[U[j]] = D[j];
+            S[C[j]]--;
+        }
+    }
+}
+
+// Descubrir una columna: deshace cover() en orden inverso
+void DLXInstance::uncover(int c)
+{
+    for (int i = U[c]; i != c; i = U[i])
+    {
+        for (int j = L[i]; j != i; j = L[j])
+        {
+            S[C[j]]++;
+            U[D[j]] = j;
+            D[U[j]] = j;
+        }
+    }
+    L[R[c]] = c;
+    R[L[c]] = c;
+}
+
+// Cubre las columnas del resto de nodos de la fila de r
+void DLXInstance::coverRow(int r)
+{
+    for (int j = R[r]; j != r; j = R[j])
+    {
+        cover(C[j]);
+    }
+}
+
+// Descubre las columnas del resto de nodos de la fila de r (orden inverso a coverRow)
+void DLXInstance::uncoverRow(int r)
+{
+    for (int j = L[r]; j != r; j = L[j])
+    {
+        uncover(C[j]);
+    }
+}
+
+// Elige la restricción con menos opciones para satisfacer
+int DLXInstance::selectColumn() const
+{
+    int best = R[0];
+    for (int c = R[best]; c != 0 && S[best] > 1; c = R[c])  // Con 0 o 1 opciones no se puede mejorar
+    {
+        if (S[c] < S[best]) { best = c; }
+    }
+    return best;
+}
+
+// Convierte un nodo en el candidato (fila, columna, número) y lo escribe en el tablero
+void DLXInstance::applyToBoard(int n, SudokuBoard& board) const
+{
+    int N = _template->get_board_size();
+    int coverRow = coverRowOf(n);
+    int row = coverRow / (N * N);
+    int col = (coverRow / N) % N;
+    int num = (coverRow % N) + 1;
+    board.set_board_data(row, col, num);
+}
@@ -0,0 +1,16 @@
+#include "FileUtils.hpp"
+#include <cstdio>
+
+bool replace_file(const std::string& tmpFilename, const std::string& filename)
+{
+    if (std::rename(tmpFilename.c_str(), filename.c_str()) != 0)
+    {
+        std::remove(filename.c_str());
+        if (std::rename(tmpFilename.c_str(), filename.c_str()) != 0)
+        {
+            std::remove(tmpFilename.c_str());
+            return false;
+        }
+    }
+    return true;
+}
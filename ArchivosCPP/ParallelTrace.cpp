@@ -0,0 +1,75 @@
+#include "ParallelTrace.hpp"
+#include <fstream>
+#include <iomanip>
+#include <omp.h>
+
+ParallelTrace* ParallelTrace::_active = nullptr;
+
+ParallelTrace::ParallelTrace()
+    : _origin(std::chrono::steady_clock::now()), _buffers(MAX_THREADS)
+{ }
+
+double ParallelTrace::now() const
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - _origin).count();
+}
+
+// Búfer del hilo que llama (nullptr si su número supera MAX_THREADS)
+std::vector<TraceEvent>* ParallelTrace::buffer()
+{
+    int thread = omp_get_thread_num();
+    return (thread < MAX_THREADS) ? &_buffers[thread] : nullptr;
+}
+
+void ParallelTrace::complete(const char* name, double begin, double end, int arg /*=-1*/)
+{
+    if (std::vector<TraceEvent>* events = buffer())
+    {
+        events->push_back({ name, 'X', begin, end - begin, arg });
+    }
+}
+
+void ParallelTrace::instant(const char* name, int arg /*=-1*/)
+{
+    if (std::vector<TraceEvent>* events = buffer())
+    {
+        events->push_back({ name, 'i', now(), 0.0, arg });
+    }
+}
+
+size_t ParallelTrace::size() const
+{
+    size_t total = 0;
+    for (const std::vector<TraceEvent>& events : _buffers) { total += events.size(); }
+    return total;
+}
+
+// Un evento por línea; los nombres de los hilos van como metadatos ('M') para que el visor los etiquete
+bool ParallelTrace::save(const std::string& filename) const
+{
+    std::ofstream out(filename);
+    if (!out.is_open()) { return false; }
+
+    out << std::fixed << std::setprecision(3);   // Microsegundos con resolución de nanosegundo
+    out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    bool first = true;
+    for (int thread = 0; thread < MAX_THREADS; ++thread)
+    {
+        if (_buffers[thread].empty()) { continue; }
+        out << (first ? "" : ",\n") << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << thread
+            << ", \"args\": {\"name\": \"omp " << thread << "\"}}";
+        first = false;
+
+        for (const TraceEvent& e : _buffers[thread])
+        {
+            out << ",\n{\"name\": \"" << e.name << "\", \"cat\": \"solver\", \"ph\": \"" << e.phase
+                << "\", \"pid\": 1, \"tid\": " << thread << ", \"ts\": " << e.ts;
+            if (e.phase == 'X') { out << ", \"dur\": " << e.dur; }
+            else { out << ", \"s\": \"t\""; }
+            if (e.arg >= 0) { out << ", \"args\": {\"arg\": " << e.arg << "}"; }
+            out << "}";
+        }
+    }
+    out << "\n]}\n";
+    return out.good();
+}
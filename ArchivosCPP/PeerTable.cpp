@@ -0,0 +1,71 @@
+#include "PeerTable.hpp"
+#include <map>
+#include <memory>
+#include <mutex>
+
+// Construye en ejecución las mismas tablas que make_peer_table_data, para tamaños sin versión de compilación
+PeerTable::PeerTable(int boxSize)
+    : _BOX_SIZE(boxSize > 0 ? boxSize : 0), _BOARD_SIZE(_BOX_SIZE * _BOX_SIZE),
+      _NUM_PEERS(_BOX_SIZE > 0 ? 2 * (_BOARD_SIZE - 1) + (_BOX_SIZE - 1) * (_BOX_SIZE - 1) : 0)
+{
+    const int BOX = _BOX_SIZE;
+    const int N = _BOARD_SIZE;
+    const int numCells = N * N;
+    _storage.assign(6 * numCells + numCells * _NUM_PEERS, 0);
+    std::uint16_t* row = _storage.data();
+    std::uint16_t* col = row + numCells;
+    std::uint16_t* box = col + numCells;
+    std::uint16_t* unitCells = box + numCells;
+    std::uint16_t* peers = unitCells + 3 * numCells;
+
+    for (int cell = 0; cell < numCells; ++cell)
+    {
+        int r = cell / N, c = cell % N, b = (r / BOX) * BOX + c / BOX;
+        row[cell] = (std::uint16_t)r;
+        col[cell] = (std::uint16_t)c;
+        box[cell] = (std::uint16_t)b;
+        unitCells[r * N + c] = (std::uint16_t)cell;
+        unitCells[(N + c) * N + r] = (std::uint16_t)cell;
+        unitCells[(2 * N + b) * N + (r % BOX) * BOX + c % BOX] = (std::uint16_t)cell;
+
+        std::uint16_t* k = peers + cell * _NUM_PEERS;
+        for (int j = 0; j < N; ++j) { if (j != c) { *k++ = (std::uint16_t)(r * N + j); } }
+        for (int i = 0; i < N; ++i) { if (i != r) { *k++ = (std::uint16_t)(i * N + c); } }
+        for (int i = r - r % BOX; i < r - r % BOX + BOX; ++i)
+        {
+            for (int j = c - c % BOX; j < c - c % BOX + BOX; ++j)
+            {
+                if (i != r && j != c) { *k++ = (std::uint16_t)(i * N + j); }
+            }
+        }
+    }
+
+    _row = row;
+    _col = col;
+    _box = box;
+    _unitCells = unitCells;
+    _peers = peers;
+}
+
+// Devuelve las tablas del tamaño de caja dado
+const PeerTable& PeerTable::get(int boxSize)
+{
+    // Tamaños habituales: tablas de compilación, sin bloqueo después de la primera llamada
+    switch (boxSize)
+    {
+        case 2: { static const PeerTable table(PEER_TABLE_DATA<2>); return table; }
+        case 3: { static const PeerTable table(PEER_TABLE_DATA<3>); return table; }
+        case 4: { static const PeerTable table(PEER_TABLE_DATA<4>); return table; }
+        case 5: { static const PeerTable table(PEER_TABLE_DATA<5>); return table; }
+        case 6: { static const PeerTable table(PEER_TABLE_DATA<6>); return table; }
+        default: break;
+    }
+
+    static std::mutex cacheMutex;
+    static std::map<int, std::unique_ptr<PeerTable>> cache;
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    std::unique_ptr<PeerTable>& entry = cache[boxSize];
+    if (!entry) { entry.reset(new PeerTable(boxSize)); }
+    return *entry;
+}
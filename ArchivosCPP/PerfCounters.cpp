@@ -0,0 +1,105 @@
+#include "PerfCounters.hpp"
+
+#ifdef __linux__
+#include <cstdint>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+const char* PERF_COUNTER_NAMES[NUM_PERF_COUNTERS] = { "cycles", "instructions", "cache_misses", "branch_misses", "llc_misses" };
+
+#ifdef __linux__
+
+// Abre un evento del grupo (group = -1 para el líder). Devuelve -1 si el evento no está disponible
+static int open_event(std::uint32_t type, std::uint64_t config, int group)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = (group == -1);    // El líder arranca parado y arrastra al resto del grupo
+    attr.inherit = 1;                 // Contar también los hilos creados después (OpenMP)
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+}
+
+PerfCounters::PerfCounters()
+{
+    _fd[CYCLES] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+    int group = _fd[CYCLES];
+    _fd[INSTRUCTIONS] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, group);
+    _fd[CACHE_MISSES] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, group);
+    _fd[BRANCH_MISSES] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, group);
+    _fd[LLC_MISSES] = open_event(PERF_TYPE_HW_CACHE,
+                                 PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+                                 group);
+}
+
+PerfCounters::~PerfCounters()
+{
+    for (int fd : _fd)
+    {
+        if (fd >= 0) { close(fd); }
+    }
+}
+
+void PerfCounters::start()
+{
+    if (_fd[CYCLES] < 0) { return; }
+    ioctl(_fd[CYCLES], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_fd[CYCLES], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfSample PerfCounters::stop()
+{
+    PerfSample sample;
+    if (_fd[CYCLES] < 0) { return sample; }
+    ioctl(_fd[CYCLES], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    for (int i = 0; i < NUM_PERF_COUNTERS; ++i)
+    {
+        std::uint64_t data[3];   // valor, tiempo activo, tiempo contando
+        if (_fd[i] < 0 || read(_fd[i], data, sizeof(data)) != (ssize_t)sizeof(data)) { continue; }
+        if (data[2] == 0) { continue; }   // El núcleo no llegó a programar el evento
+        sample.value[i] = (data[2] < data[1]) ? (long long)((double)data[0] * data[1] / data[2]) : (long long)data[0];
+        sample.valid[i] = true;
+    }
+    return sample;
+}
+
+#else
+
+PerfCounters::PerfCounters()
+{
+    for (int& fd : _fd) { fd = -1; }
+}
+
+PerfCounters::~PerfCounters() {}
+
+void PerfCounters::start() {}
+
+PerfSample PerfCounters::stop() { return PerfSample(); }
+
+#endif
+
+bool PerfCounters::is_available() const
+{
+    for (int fd : _fd)
+    {
+        if (fd >= 0) { return true; }
+    }
+    return false;
+}
+
+PerfSample PerfCounters::measure_solve(SudokuSolver& solver)
+{
+    start();
+    solver.solve();
+    return stop();
+}
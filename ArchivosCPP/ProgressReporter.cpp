@@ -0,0 +1,40 @@
+#include "ProgressReporter.hpp"
+#include <iostream>
+#include "helper.hpp"
+
+ProgressReporter::ProgressReporter(const std::atomic<int>& progress, int total, int interval_ms /*=DEFAULT_INTERVAL_MS*/)
+    : _progress(progress), _total(total), _interval(interval_ms)
+{
+    if (_total > 0) { _thread = std::thread(&ProgressReporter::run, this); }
+}
+
+ProgressReporter::~ProgressReporter()
+{
+    if (!_thread.joinable()) { return; }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _wake.notify_one();
+    _thread.join();
+}
+
+// Redibuja la barra si la búsqueda ha llegado más lejos que la última vez
+void ProgressReporter::draw()
+{
+    int filled = _progress.load(std::memory_order_relaxed);
+    if (filled <= _shown) { return; }
+    _shown = filled;
+    printProgressBar2(double(filled) / _total);
+}
+
+void ProgressReporter::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    draw();
+    while (!_wake.wait_for(lock, _interval, [this] { return _stop; }))
+    {
+        draw();
+    }
+    draw();   // Estado final (100% si se resolvió)
+}
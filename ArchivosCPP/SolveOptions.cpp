@@ -0,0 +1,73 @@
+#include "SolveOptions.hpp"
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__linux__)
+#include <fstream>
+#include <unistd.h>
+#endif
+
+const char* to_string(SOLVE_STATUS status)
+{
+    switch (status)
+    {
+        case SOLVE_STATUS::RUNNING:                 return "RUNNING";
+        case SOLVE_STATUS::SOLVED:                  return "SOLVED";
+        case SOLVE_STATUS::NO_SOLUTION:             return "NO_SOLUTION";
+        case SOLVE_STATUS::TIMED_OUT:               return "TIMED_OUT";
+        case SOLVE_STATUS::NODE_BUDGET_EXHAUSTED:   return "NODE_BUDGET_EXHAUSTED";
+        case SOLVE_STATUS::MEMORY_BUDGET_EXHAUSTED: return "MEMORY_BUDGET_EXHAUSTED";
+    }
+    return "UNKNOWN";
+}
+
+void SolveBudget::reset(const SolveOptions& options)
+{
+    _options = options;
+    _nodes.store(0, std::memory_order_relaxed);
+    _status.store(static_cast<int>(SOLVE_STATUS::RUNNING), std::memory_order_relaxed);
+}
+
+// Solo el primer límite alcanzado queda registrado
+void SolveBudget::stop(SOLVE_STATUS status)
+{
+    int running = static_cast<int>(SOLVE_STATUS::RUNNING);
+    _status.compare_exchange_strong(running, static_cast<int>(status), std::memory_order_relaxed);
+}
+
+bool SolveBudget::check_limits()
+{
+    if (exhausted()) { return true; }
+    if (std::chrono::steady_clock::now() >= _options.deadline)
+    {
+        stop(SOLVE_STATUS::TIMED_OUT);
+        return true;
+    }
+    if (_options.memory_budget > 0 && current_memory_usage() > _options.memory_budget)
+    {
+        stop(SOLVE_STATUS::MEMORY_BUDGET_EXHAUSTED);
+        return true;
+    }
+    return false;
+}
+
+std::size_t current_memory_usage()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return counters.WorkingSetSize;
+    }
+    return 0;
+#elif defined(__linux__)
+    // Segundo campo de /proc/self/statm: páginas residentes
+    std::ifstream statm("/proc/self/statm");
+    std::size_t size = 0, resident = 0;
+    if (!(statm >> size >> resident)) { return 0; }
+    return resident * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
@@ -1,6 +1,7 @@
 #include "SudokuBoard.hpp"
 #include "helper.hpp"
 #include "termcolor.hpp"
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <vector>
@@ -11,7 +12,7 @@
 using namespace std;
 
 // Función para leer el tablero de Sudoku desde un archivo
-const Board SudokuBoard::read_input(const string& filename)
+void SudokuBoard::read_input(const string& filename)
 {
     ifstream inputFile(filename);   // Abre el archivo de entrada
 
@@ -23,35 +24,30 @@ const Board SudokuBoard::read_input(const string& filename)
         exit(1);  // Finaliza el programa en caso de error
     }
 
-    inputFile >> _BOARD_SIZE;  // Lee el tamaño del tablero desde el archivo
-    _BOX_SIZE = sqrt(_BOARD_SIZE);  // Calcula el tamaño de las subcajas (raíz cuadrada de _BOARD_SIZE)
+    int boardSize = 0;
+    inputFile >> boardSize;  // Lee el tamaño del tablero desde el archivo
+    _BOARD_SIZE = boardSize;
+    _BOX_SIZE = sqrt(boardSize);  // Calcula el tamaño de las subcajas (raíz cuadrada de _BOARD_SIZE)
 
     // Inicializa el tablero con celdas vacías (valor 0)
-    Board sudokuBoard(_BOARD_SIZE, vector<int>(_BOARD_SIZE, 0));
+    _cells.assign(boardSize * boardSize, _EMPTY_CELL_VALUE);
 
-    int num_empty_cells = 0;  // Contador para el número de celdas vacías
-    for (int row = 0; row < _BOARD_SIZE; ++row)  // Recorre las filas
+    for (int cell = 0; cell < boardSize * boardSize; ++cell)  // Recorre las celdas fila a fila
     {
-        for (int col = 0; col < _BOARD_SIZE; ++col)  // Recorre las columnas
-        {
-            int value;
-            inputFile >> value;  // Lee el valor de la celda desde el archivo
-            sudokuBoard[row][col] = value;  // Asigna el valor leído al tablero
-            num_empty_cells += (value == 0);  // Incrementa el contador si la celda está vacía
-        }
+        int value = 0;
+        inputFile >> value;  // Lee el valor de la celda desde el archivo
+        _cells[cell] = (Cell)value;  // Asigna el valor leído al tablero
     }
-    _INIT_NUM_EMPTY_CELLS = num_empty_cells;  // Guarda el número total de celdas vacías
+    rebuild_occupancy();  // Cuenta las celdas vacías y marca los números de cada unidad
+    _INIT_NUM_EMPTY_CELLS = _numEmpty;  // Guarda el número total de celdas vacías
 
     inputFile.close();   // Cierra el archivo
-
-    return sudokuBoard;  // Devuelve el tablero leído
 }
 
 // Función para escribir la solución del Sudoku en un archivo de salida
 void write_output(const SudokuBoard& solutionBoard)
 {
-    // Obtiene los datos del tablero de solución y su tamaño
-    Board solution = solutionBoard.get_board_data();
+    // Obtiene el tamaño del tablero de solución
     int BOARD_SIZE = solutionBoard.get_board_size();
     int BOX_SIZE = solutionBoard.get_box_size();
 
@@ -64,7 +60,7 @@ void write_output(const SudokuBoard& solutionBoard)
         for (int c = 0; c < BOARD_SIZE; ++c)  // Recorre las columnas
         {
             // Escribe el valor de la celda con el formato adecuado
-            outputFile << setw(digit) << solution[r][c];
+            outputFile << setw(digit) << solutionBoard.at(r, c);
 
             if (c != BOARD_SIZE - 1)  // Añade un espacio entre valores, excepto al final de la fila
             {
@@ -94,28 +90,60 @@ void write_output(const SudokuBoard& solutionBoard)
 }
 
 // Constructor de la clase SudokuBoard que carga el tablero desde un archivo
-SudokuBoard::SudokuBoard(const string& filename)
-    : _board_data(read_input(filename))  // Llama a la función read_input para inicializar el tablero
+SudokuBoard::SudokuBoard(const string& filename, bool print_message /*=true*/)
 {
+    read_input(filename);  // Llama a la función read_input para inicializar el tablero
+
     // Muestra un mensaje indicando que se ha cargado el tablero
-    cout << "Load the initial Sudoku board from "
-         << termcolor::yellow << filename << termcolor::reset << "..." << "\n";
+    if (print_message)
+    {
+        cout << "Load the initial Sudoku board from "
+             << termcolor::yellow << filename << termcolor::reset << "..." << "\n";
+    }
+}
+
+// Constructor de la clase SudokuBoard a partir de datos en memoria (por ejemplo, un sudoku generado)
+SudokuBoard::SudokuBoard(const Board& board_data)
+    : _BOARD_SIZE(board_data.size()),
+      _BOX_SIZE(sqrt(board_data.size()))
+{
+    _cells.reserve(_BOARD_SIZE * _BOARD_SIZE);
+    for (const vector<int>& row : board_data)  // Copia las filas una tras otra en el bloque contiguo
+    {
+        for (int value : row) { _cells.push_back((Cell)value); }
+    }
+    rebuild_occupancy();  // Cuenta las celdas vacías y marca los números de cada unidad
+    _INIT_NUM_EMPTY_CELLS = _numEmpty;  // Guarda el número total de celdas vacías
+}
+
+// Devuelve una copia del tablero en forma de filas
+Board SudokuBoard::get_board_data() const
+{
+    Board board_data(_BOARD_SIZE, vector<int>(_BOARD_SIZE));
+    for (int row = 0; row < _BOARD_SIZE; ++row)
+    {
+        for (int col = 0; col < _BOARD_SIZE; ++col) { board_data[row][col] = at(row, col); }
+    }
+    return board_data;
 }
 
-// Constructor de copia de la clase SudokuBoard
-SudokuBoard::SudokuBoard(const SudokuBoard& anotherSudokuBoard)
-    // Copia todos los atributos del objeto SudokuBoard original
-    : _board_data(anotherSudokuBoard._board_data),
-      _BOX_SIZE(anotherSudokuBoard._BOX_SIZE),
-      _BOARD_SIZE(anotherSudokuBoard._BOARD_SIZE),
-      _MIN_VALUE(anotherSudokuBoard._MIN_VALUE),
-      _MAX_VALUE(anotherSudokuBoard._MAX_VALUE),
-      _NUM_CONSTRAINTS(anotherSudokuBoard._NUM_CONSTRAINTS),
-      _INIT_NUM_EMPTY_CELLS(anotherSudokuBoard._INIT_NUM_EMPTY_CELLS),
-      _EMPTY_CELL_VALUE(anotherSudokuBoard._EMPTY_CELL_VALUE),
-      _EMPTY_CELL_CHARACTER(anotherSudokuBoard._EMPTY_CELL_CHARACTER),
-      _COVER_MATRIX_START_INDEX(anotherSudokuBoard._COVER_MATRIX_START_INDEX)
-{ }
+// Función para escribir el tablero en el formato de entrada (el mismo que lee read_input)
+void write_input(const SudokuBoard& board, const string& filename)
+{
+    ofstream outputFile(filename);  // Crea el archivo de salida
+
+    int BOARD_SIZE = board.get_board_size();
+    outputFile << BOARD_SIZE << "\n";
+    for (int r = 0; r < BOARD_SIZE; ++r)  // Recorre las filas
+    {
+        for (int c = 0; c < BOARD_SIZE; ++c)  // Recorre las columnas
+        {
+            outputFile << board.at(r, c) << ((c != BOARD_SIZE - 1) ? " " : "\n");
+        }
+    }
+
+    outputFile.close();  // Cierra el archivo de salida
+}
 
 // Método para obtener el número total de celdas en el tablero
 int SudokuBoard::get_num_total_cells() const
@@ -123,18 +151,92 @@ int SudokuBoard::get_num_total_cells() const
     return _BOARD_SIZE * _BOARD_SIZE;  // Calcula el número total de celdas (BOARD_SIZE^2)
 }
 
-// Método para obtener el número de celdas vacías en el tablero
-int SudokuBoard::get_num_empty_cells() const
+// Palabras de máscara de las filas, columnas y cajas
+int SudokuBoard::num_mask_words() const
+{
+    int boxesPerRow = (_BOX_SIZE > 0) ? (_BOARD_SIZE + _BOX_SIZE - 1) / _BOX_SIZE : 0;  // Cajas incompletas si el tamaño no es un cuadrado
+    return (2 * _BOARD_SIZE + boxesPerRow * boxesPerRow) * _maskWords;
+}
+
+// Recalcula el número de celdas vacías y las máscaras de fila, columna y caja a partir de las celdas.
+// Las máscaras se colocan detrás de las celdas, en el mismo bloque
+void SudokuBoard::rebuild_occupancy()
+{
+    const int numCells = get_num_total_cells();
+    _maskWords = (_BOARD_SIZE + _MASK_BITS - 1) / _MASK_BITS;
+    _cells.resize(numCells + num_mask_words());
+    fill(_cells.begin() + numCells, _cells.end(), 0);
+    _repeated = false;
+    _numEmpty = 0;
+
+    for (int cell = 0; cell < numCells; ++cell)
+    {
+        if (_cells[cell] == _EMPTY_CELL_VALUE) { ++_numEmpty; }
+        else { add_value(cell, _cells[cell]); }
+    }
+}
+
+// Marca num como usado en la fila, la columna y la caja de la celda
+void SudokuBoard::add_value(int cell, int num)
+{
+    if (!in_range(num)) { return; }  // Los valores fuera de rango no ocupan ninguna máscara
+    int row = cell / _BOARD_SIZE, col = cell % _BOARD_SIZE;
+    Mask bit = bit_of(num);
+    for (int index : { row_mask(row, num), col_mask(col, num), box_mask(row, col, num) })
+    {
+        if (mask(index) & bit) { _repeated = true; }  // Ya estaba: el tablero repite el número en esa unidad
+        mask(index) |= bit;
+    }
+}
+
+// Desmarca num de las unidades de la celda (que ya no lo contiene). Si el tablero ha tenido números repetidos,
+// otra celda de la unidad puede seguir teniéndolo, así que se recorre la unidad antes de borrar el bit
+void SudokuBoard::erase_value(int cell, int num)
+{
+    if (!in_range(num)) { return; }
+    int row = cell / _BOARD_SIZE, col = cell % _BOARD_SIZE;
+    Mask bit = bit_of(num);
+    if (!_repeated)
+    {
+        mask(row_mask(row, num)) &= ~bit;
+        mask(col_mask(col, num)) &= ~bit;
+        mask(box_mask(row, col, num)) &= ~bit;
+        return;
+    }
+
+    bool inRow = false, inCol = false, inBox = false;
+    for (int i = 0; i < _BOARD_SIZE; ++i)
+    {
+        inRow = inRow || at(row, i) == num;
+        inCol = inCol || at(i, col) == num;
+    }
+    int firstRow = row - row % _BOX_SIZE, firstCol = col - col % _BOX_SIZE;
+    for (int r = firstRow; r < firstRow + _BOX_SIZE && r < _BOARD_SIZE; ++r)
+    {
+        for (int c = firstCol; c < firstCol + _BOX_SIZE && c < _BOARD_SIZE; ++c) { inBox = inBox || at(r, c) == num; }
+    }
+    if (!inRow) { mask(row_mask(row, num)) &= ~bit; }
+    if (!inCol) { mask(col_mask(col, num)) &= ~bit; }
+    if (!inBox) { mask(box_mask(row, col, num)) &= ~bit; }
+}
+
+// true si alguna otra celda de la fila, la columna o la caja contiene num (solo para tableros con repetidos)
+bool SudokuBoard::peer_holds(int row, int col, int num) const
 {
-    int n = 0;  // Contador de celdas vacías
-    for (int i = 0; i < _BOARD_SIZE; ++i)  // Recorre todas las filas
+    for (int i = 0; i < _BOARD_SIZE; ++i)
+    {
+        if (i != col && at(row, i) == num) { return true; }
+        if (i != row && at(i, col) == num) { return true; }
+    }
+    int firstRow = row - row % _BOX_SIZE, firstCol = col - col % _BOX_SIZE;
+    for (int r = firstRow; r < firstRow + _BOX_SIZE && r < _BOARD_SIZE; ++r)
     {
-        for (int j = 0; j < _BOARD_SIZE; ++j)  // Recorre todas las columnas
+        for (int c = firstCol; c < firstCol + _BOX_SIZE && c < _BOARD_SIZE; ++c)
         {
-            n += (this->at(i, j) == get_empty_cell_value());  // Incrementa el contador si la celda está vacía
+            if ((r != row || c != col) && at(r, c) == num) { return true; }
         }
     }
-    return n;  // Devuelve el número total de celdas vacías
+    return false;
 }
 
 // Método para obtener los números en una fila específica
@@ -144,7 +246,7 @@ vector<int> SudokuBoard::getNumbersInRow(int indexOfRows) const
 
     for (int col = 0; col < _BOARD_SIZE; ++col)  // Recorre las columnas de la fila
     {
-        int num = _board_data[indexOfRows][col];  // Obtiene el valor de la celda
+        int num = at(indexOfRows, col);  // Obtiene el valor de la celda
         if (num == _EMPTY_CELL_VALUE) continue;  // Omite las celdas vacías
         numbersInRow.push_back(num);  // Añade el número a la lista si no está vacío
     }
@@ -159,7 +261,7 @@ vector<int> SudokuBoard::getNumbersInCol(int indexOfColumns) const
 
     for (int row = 0; row < _BOARD_SIZE; ++row)  // Recorre las filas de la columna
     {
-        int num = _board_data[row][indexOfColumns];  // Obtiene el valor de la celda
+        int num = at(row, indexOfColumns);  // Obtiene el valor de la celda
         if (num == _EMPTY_CELL_VALUE) continue;  // Omite las celdas vacías
         numbersInCol.push_back(num);  // Añade el número a la lista si no está vacío
     }
@@ -167,33 +269,9 @@ vector<int> SudokuBoard::getNumbersInCol(int indexOfColumns) const
     return numbersInCol;  // Devuelve los números encontrados en la columna
 }
 
-// Sobrecarga del operador de asignación para la clase SudokuBoard
-SudokuBoard& SudokuBoard::operator= (const SudokuBoard& anotherSudokuBoard)
-{
-    if (this != &anotherSudokuBoard)  // Verifica que no sea autoasignación
-    {
-        // Copia todos los atributos del otro tablero de Sudoku
-        _board_data = anotherSudokuBoard._board_data;
-        _BOX_SIZE = anotherSudokuBoard._BOX_SIZE;
-        _BOARD_SIZE = anotherSudokuBoard._BOARD_SIZE;
-        _MIN_VALUE = anotherSudokuBoard._MIN_VALUE;
-        _MAX_VALUE = anotherSudokuBoard._MAX_VALUE;
-        _NUM_CONSTRAINTS = anotherSudokuBoard._NUM_CONSTRAINTS;
-        _INIT_NUM_EMPTY_CELLS = anotherSudokuBoard._INIT_NUM_EMPTY_CELLS;
-        _EMPTY_CELL_VALUE = anotherSudokuBoard._EMPTY_CELL_VALUE;
-        _EMPTY_CELL_CHARACTER = anotherSudokuBoard._EMPTY_CELL_CHARACTER;
-        _COVER_MATRIX_START_INDEX = anotherSudokuBoard._COVER_MATRIX_START_INDEX;
-    }
-
-    return *this;  // Devuelve el objeto actual
-}
-
 // Función para imprimir el tablero de Sudoku en consola
 void print_board(const SudokuBoard& board)
 {
-    // Obtiene los datos del tablero
-    Board grid = board._board_data;
-
     for (int i = 0; i < board._BOARD_SIZE; ++i)  // Recorre las filas
     {
         // Si es el inicio de una nueva subcaja horizontal, imprime una línea divisoria
@@ -216,17 +294,17 @@ void print_board(const SudokuBoard& board)
             // Imprime el último número de la fila
             if (j == board._BOARD_SIZE - 1)
             {
-                cout << setfill(' ') << setw(2) << grid[i][j] << "\n";  // Sin espacio extra al final
+                cout << setfill(' ') << setw(2) << board.at(i, j) << "\n";  // Sin espacio extra al final
             }
             // Para los bordes de las subcajas
             else if (j % board._BOX_SIZE == board._BOX_SIZE - 1)
             {
-                cout << setfill(' ') << setw(2) << grid[i][j];
+                cout << setfill(' ') << setw(2) << board.at(i, j);
             }
             // Imprime los números separados por espacio
             else
             {
-                cout << setfill(' ') << setw(2) << grid[i][j] << " ";
+                cout << setfill(' ') << setw(2) << board.at(i, j) << " ";
             }
         }
     }
@@ -235,8 +313,6 @@ void print_board(const SudokuBoard& board)
 // Sobrecarga del operador << para imprimir el tablero en cualquier flujo de salida (como cout o archivos)
 ostream& operator<< (ostream &out, const SudokuBoard& board)
 {
-    // Obtiene los datos del tablero
-    Board grid = board.get_board_data();
     int BOARD_SIZE = board.get_board_size();
     int BOX_SIZE = board.get_box_size();
     int EMPTY_CELL_VALUE = board.get_empty_cell_value();
@@ -262,7 +338,7 @@ ostream& operator<< (ostream &out, const SudokuBoard& board)
             }	
 
             // Si la celda está vacía, imprime el carácter especial para celdas vacías
-            string forPrinting = (grid[i][j] == EMPTY_CELL_VALUE) ? EMPTY_CELL_CHARACTER : to_string(grid[i][j]);
+            string forPrinting = (board.at(i, j) == EMPTY_CELL_VALUE) ? EMPTY_CELL_CHARACTER : to_string(board.at(i, j));
 
             // Imprime el último número de la fila
             if (j == BOARD_SIZE - 1)
@@ -285,148 +361,6 @@ ostream& operator<< (ostream &out, const SudokuBoard& board)
     return out;  // Retorna el flujo de salida para encadenar operaciones
 }
 
-// Función para calcular el índice en la matriz de cobertura basado en fila, columna y número
-int SudokuBoard::indexInCoverMatrix(int row, int col, int num)
-{
-    // Fórmula para calcular la posición en la matriz de cobertura
-    return (row - 1) * _BOARD_SIZE * _BOARD_SIZE + (col - 1) * _BOARD_SIZE + (num - 1);
-}
-
-// Función para crear restricciones de subcajas en la matriz de cobertura
-int SudokuBoard::createBoxConstraints(CoverMatrix& coverMatrix, int header)
-{
-    // Recorre las subcajas (por bloques)
-	for (int row = _COVER_MATRIX_START_INDEX; row <= _BOARD_SIZE; row += _BOX_SIZE)
-    {
-        for (int col = _COVER_MATRIX_START_INDEX; col <= _BOARD_SIZE; col += _BOX_SIZE)
-        {
-            // Recorre cada valor posible dentro de la subcaja
-            for (int n = _COVER_MATRIX_START_INDEX; n <= _BOARD_SIZE; ++n, ++header)
-            {
-                // Recorre cada celda dentro de la subcaja
-                for (int rowDelta = 0; rowDelta < _BOX_SIZE; ++rowDelta)
-                {
-                    for (int colDelta = 0; colDelta < _BOX_SIZE; ++colDelta)
-                    {
-                        // Calcula el índice y actualiza la matriz de cobertura
-                        int index = indexInCoverMatrix(row + rowDelta, col + colDelta, n);
-                        coverMatrix[index][header] = 1;
-                    }
-                }
-            }
-        }
-    }
-
-    return header;  // Retorna el siguiente encabezado
-}
-
-// Función para crear restricciones de columnas en la matriz de cobertura
-int SudokuBoard::createColumnConstraints(CoverMatrix& coverMatrix, int header)
-{
-    // Recorre las columnas y valores posibles
-	for (int col = _COVER_MATRIX_START_INDEX; col <= _BOARD_SIZE; ++col)
-    {
-        for (int n = _COVER_MATRIX_START_INDEX; n <= _BOARD_SIZE; ++n, ++header)
-        {
-            for (int row = _COVER_MATRIX_START_INDEX; row <= _BOARD_SIZE; ++row)
-            {
-                // Calcula el índice y actualiza la matriz de cobertura
-                int index = indexInCoverMatrix(row, col, n);
-                coverMatrix[index][header] = 1;
-            }
-        }
-    }
-
-    return header;
-}
-
-// Función para crear restricciones de filas en la matriz de cobertura
-int SudokuBoard::createRowConstraints(CoverMatrix& coverMatrix, int header)
-{
-    // Recorre las filas y valores posibles
-	for (int row = _COVER_MATRIX_START_INDEX; row <= _BOARD_SIZE; ++row)
-    {
-        for (int n = _COVER_MATRIX_START_INDEX; n <= _BOARD_SIZE; ++n, ++header)
-        {
-            for (int col = _COVER_MATRIX_START_INDEX; col <= _BOARD_SIZE; ++col)
-            {
-                // Calcula el índice y actualiza la matriz de cobertura
-                int index = indexInCoverMatrix(row, col, n);
-                coverMatrix[index][header] = 1;
-            }
-        }
-    }
-
-    return header;
-}
-
-// Función para crear restricciones de celdas en la matriz de cobertura
-int SudokuBoard::createCellConstraints(CoverMatrix& coverMatrix, int header)
-{
-    // Recorre las celdas y valores posibles
-	for (int row = _COVER_MATRIX_START_INDEX; row <= _BOARD_SIZE; ++row)
-    {
-        for (int col = _COVER_MATRIX_START_INDEX; col <= _BOARD_SIZE; ++col, ++header)
-        {
-            for (int n = _COVER_MATRIX_START_INDEX; n <= _BOARD_SIZE; ++n)
-            {
-                // Calcula el índice y actualiza la matriz de cobertura
-                int index = indexInCoverMatrix(row, col, n);
-                coverMatrix[index][header] = 1;
-            }
-        }
-    }
-
-    return header;
-}
-
-// Función que crea la matriz de cobertura combinando todas las restricciones
-void SudokuBoard::createCoverMatrix(CoverMatrix& coverMatrix)
-{
-    // Calcula el tamaño de la matriz de cobertura
-	int numberOfRows = _BOARD_SIZE * _BOARD_SIZE * _MAX_VALUE;
-	int numberOfCols = _BOARD_SIZE * _BOARD_SIZE * _NUM_CONSTRAINTS;
-
-    // Inicializa la matriz de cobertura con ceros
-	coverMatrix.resize(numberOfRows, vector<int>(numberOfCols));
-
-    // Llama a las funciones para agregar las restricciones
-    int header = 0;
-    header = createCellConstraints(coverMatrix, header);
-    header = createRowConstraints(coverMatrix, header);
-    header = createColumnConstraints(coverMatrix, header);
-    createBoxConstraints(coverMatrix, header);
-}
-
-// Función que convierte el tablero a una matriz de cobertura, marcando celdas ya ocupadas
-void SudokuBoard::convertToCoverMatrix(CoverMatrix& coverMatrix)
-{	
-    // Recorre cada celda del tablero
-    for (int row = _COVER_MATRIX_START_INDEX; row <= _BOARD_SIZE; ++row)
-    {
-        for (int col = _COVER_MATRIX_START_INDEX; col <= _BOARD_SIZE; ++col)
-        {
-            int n = _board_data[row - 1][col - 1];
-
-            // Si la celda no está vacía, desactiva los valores que no son válidos
-            if (n != _EMPTY_CELL_VALUE)
-            {
-                for (int num = _MIN_VALUE; num <= _MAX_VALUE; ++num)
-                {
-                    if (num != n)
-                    {
-                        int index = indexInCoverMatrix(row, col, num);
-                        for (int i = 0; i < _BOARD_SIZE * _BOARD_SIZE * _NUM_CONSTRAINTS; ++i)
-                        {
-                            coverMatrix[index][i] = 0;
-                        }
-                    }
-                }
-            }
-        }
-    }
-}
-
 // Función que crea la matriz de estado (posibilidades para cada celda)
 void SudokuBoard::createStateMatrix(StateMatrix& stateMatrix)
 {
@@ -439,7 +373,7 @@ void SudokuBoard::convertToStateMatrix(StateMatrix& stateMatrix)
 {
     // Crea un conjunto de posibles valores
 	set<int> setOfPossibleValues;
-	for (int num = _MIN_VALUE; num < _MAX_VALUE; ++num)
+	for (int num = _MIN_VALUE; num < _BOARD_SIZE; ++num)
 	{
 		setOfPossibleValues.insert(num);
 	}
@@ -450,7 +384,7 @@ void SudokuBoard::convertToStateMatrix(StateMatrix& stateMatrix)
 		for (int j = 0; j < _BOARD_SIZE; ++j)
 		{
             // Si la celda está vacía, asigna el conjunto de valores posibles
-			stateMatrix[i][j] = _board_data[i][j];
+			stateMatrix[i][j] = at(i, j);
 			if (get<int>(stateMatrix[i][j]) == _EMPTY_CELL_VALUE)
 			{
 				stateMatrix[i][j] = setOfPossibleValues;
@@ -0,0 +1,134 @@
+#include "SudokuGenerator.hpp"
+#include "BitBoard.hpp"
+#include "SolveOptions.hpp"
+#include <algorithm>
+#include <omp.h>
+
+// Asignaciones por celda que se permiten a un relleno antes de abandonarlo y empezar de nuevo. Con la
+// propagación casi todos terminan al primer intento; el límite corta la cola de los que se meten en una rama
+// sin salida profunda, que en 25x25 podían no terminar nunca
+#define FILL_NODES_PER_CELL 4
+
+// Nodos que puede gastar la comprobación de unicidad de una eliminación. Cerca del mínimo de pistas algunas
+// comprobaciones de 25x25 tardan segundos o minutos; si no termina a tiempo la pista se deja, así que el sudoku
+// sigue teniendo solución única aunque quede alguna pista de más
+#define UNIQUENESS_NODE_BUDGET 2000
+
+namespace {
+
+// Comprueba la unicidad con el conteo de máscaras de bits de has_unique_solution, limitado a
+// UNIQUENESS_NODE_BUDGET nodos: una comprobación que se queda sin presupuesto cuenta como no única
+bool stays_unique(const Board& grid)
+{
+    SolveOptions options;
+    options.node_budget = UNIQUENESS_NODE_BUDGET;
+    SolveBudget budget;
+    budget.reset(options);
+
+    return with_bitboard(SudokuBoard(grid), [&budget](auto& bitboard) {
+        bitboard.set_budget(&budget);
+        return bitboard.count_solutions(2) == 1 && !budget.exhausted();
+    });
+}
+
+}
+
+// Constructor del generador
+SudokuGenerator::SudokuGenerator(const GeneratorOptions& options)
+    : _options(options)
+{ }
+
+// Cuadrícula completa aleatoria
+Board SudokuGenerator::random_full_grid(int box_size, std::mt19937& rng)
+{
+    int N = box_size * box_size;
+    SudokuBoard emptyBoard(Board(N, std::vector<int>(N, 0)));
+    with_bitboard(emptyBoard, [&emptyBoard, &rng, N](auto& bitboard) {
+        while (!bitboard.fill_random(rng, (long long) FILL_NODES_PER_CELL * N * N)) { }
+        bitboard.write_to(emptyBoard);
+    });
+    return emptyBoard.get_board_data();
+}
+
+// Grupo de celdas simétricas de cell según la simetría elegida
+std::vector<int> SudokuGenerator::symmetric_group(int cell) const
+{
+    int N = _options.box_size * _options.box_size;
+    int row = cell / N;
+    int col = cell % N;
+
+    int other = cell;
+    switch (_options.symmetry)
+    {
+        case SYMMETRY::ROTATIONAL: other = (N - 1 - row) * N + (N - 1 - col); break;
+        case SYMMETRY::MIRROR:     other = row * N + (N - 1 - col); break;
+        case SYMMETRY::DIAGONAL:   other = col * N + row; break;
+        default: break;
+    }
+
+    std::vector<int> group(1, cell);
+    if (other != cell) { group.push_back(other); }
+    return group;
+}
+
+// Genera un sudoku: cuadrícula completa y eliminación de pistas mientras la solución siga siendo única
+SudokuBoard SudokuGenerator::generate(std::mt19937& rng) const
+{
+    int N = _options.box_size * _options.box_size;
+    Board grid = random_full_grid(_options.box_size, rng);
+
+    // Agrupar las celdas según la simetría y barajar el orden de eliminación
+    std::vector<std::vector<int>> groups;
+    std::vector<bool> assigned(N * N, false);
+    for (int cell = 0; cell < N * N; ++cell)
+    {
+        if (assigned[cell]) { continue; }
+        std::vector<int> group = symmetric_group(cell);
+        for (int c : group) { assigned[c] = true; }
+        groups.push_back(group);
+    }
+    std::shuffle(groups.begin(), groups.end(), rng);
+
+    int clues = N * N;
+    for (const std::vector<int>& group : groups)
+    {
+        if (clues <= _options.target_clues) { break; }
+        if (clues - (int) group.size() < _options.target_clues) { continue; }   // Se pasaría del objetivo
+
+        std::vector<int> removed;
+        for (int c : group)
+        {
+            removed.push_back(grid[c / N][c % N]);
+            grid[c / N][c % N] = 0;
+        }
+
+        if (stays_unique(grid))
+        {
+            clues -= group.size();
+        }
+        else
+        {
+            for (std::size_t i = 0; i < group.size(); ++i)   // Deshacer: la solución dejaría de ser única
+            {
+                grid[group[i] / N][group[i] % N] = removed[i];
+            }
+        }
+    }
+
+    return SudokuBoard(grid);
+}
+
+// Genera un lote de sudokus repartiendo las generaciones entre los hilos
+std::vector<SudokuBoard> SudokuGenerator::generate_batch(int count, int num_threads /*=0*/) const
+{
+    std::vector<SudokuBoard> puzzles(count);
+    if (num_threads <= 0) { num_threads = omp_get_max_threads(); }
+
+    #pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads) default(none) shared(puzzles, count)
+    for (int i = 0; i < count; ++i)
+    {
+        std::mt19937 rng(_options.seed + i);   // Semilla por sudoku: mismo resultado con cualquier número de hilos
+        puzzles[i] = generate(rng);
+    }
+    return puzzles;
+}
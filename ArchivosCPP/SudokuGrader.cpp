@@ -0,0 +1,441 @@
+#include "SudokuGrader.hpp"
+#include "BitBoard.hpp"
+#include <algorithm>
+
+namespace {
+
+// Contadores del solucionador de referencia
+struct ReferenceSearch {
+    long long nodes = 0;
+    long long backtracks = 0;
+    int solutions = 0;
+};
+
+// Backtracking MRV con máscaras de bits que cuenta nodos y retrocesos (se detiene en la segunda solución)
+void reference_search(BitBoard& bitboard, ReferenceSearch& search)
+{
+    if (search.solutions >= 2 || search.nodes >= SudokuGrader::SEARCH_NODE_LIMIT) { return; }
+    ++search.nodes;
+    if (bitboard.get_num_empty_cells() == 0)
+    {
+        ++search.solutions;
+        return;
+    }
+
+    BitBoard::Mask cellCandidates = 0;
+    int cell = bitboard.take_cell(cellCandidates);
+    while (cellCandidates && search.solutions < 2)
+    {
+        BitBoard::Mask bit = cellCandidates & (~cellCandidates + 1);
+        cellCandidates ^= bit;
+        int num = __builtin_ctzll(bit) + 1;
+
+        int solutionsBefore = search.solutions;
+        bitboard.place(cell, num);
+        reference_search(bitboard, search);
+        bitboard.remove(cell, num);
+        if (search.nodes >= SudokuGrader::SEARCH_NODE_LIMIT) { break; }   // Tope alcanzado: no contar el desapilado como retroceso
+        if (search.solutions == solutionsBefore) { ++search.backtracks; }   // El subárbol no llevó a ninguna solución
+    }
+    bitboard.restore_cell();
+}
+
+}
+
+// Nombre legible de una técnica
+std::string to_string(TECHNIQUE technique)
+{
+    switch (technique)
+    {
+        case TECHNIQUE::NAKED_SINGLE:      return "naked single";
+        case TECHNIQUE::HIDDEN_SINGLE:     return "hidden single";
+        case TECHNIQUE::LOCKED_CANDIDATES: return "locked candidates";
+        case TECHNIQUE::NAKED_PAIR:        return "naked pair";
+        case TECHNIQUE::HIDDEN_PAIR:       return "hidden pair";
+        case TECHNIQUE::NAKED_TRIPLE:      return "naked triple";
+        case TECHNIQUE::X_WING:            return "x-wing";
+        default:                           return "search";
+    }
+}
+
+// Categoría de dificultad según la técnica más difícil necesaria
+std::string GradeReport::difficulty() const
+{
+    if (hardest <= TECHNIQUE::HIDDEN_SINGLE) { return "easy"; }
+    if (hardest <= TECHNIQUE::HIDDEN_PAIR) { return "medium"; }
+    if (hardest <= TECHNIQUE::X_WING) { return "hard"; }
+    return "expert";
+}
+
+// Coloca num en la celda y lo elimina de los candidatos de sus vecinas (las celdas de sus tres unidades)
+void SudokuGrader::assign(int cell, int num)
+{
+    Mask bit = Mask(1) << (num - 1);
+    _values[cell] = num;
+    _candidates[cell] = 0;
+    --_numEmpty;
+
+    for (int peer : _table->peers(cell))
+    {
+        if (_values[peer] == 0) { eliminate(peer, bit); }
+    }
+}
+
+// Quita candidatos de una celda vacía
+bool SudokuGrader::eliminate(int cell, Mask mask)
+{
+    if (_values[cell] != 0 || !(_candidates[cell] & mask)) { return false; }
+    _candidates[cell] &= ~mask;
+    if (_candidates[cell] == 0) { _contradiction = true; }   // Celda vacía sin candidatos
+    return true;
+}
+
+// Celdas con un único candidato
+bool SudokuGrader::naked_single()
+{
+    bool progress = false;
+    for (int cell = 0; cell < _BOARD_SIZE * _BOARD_SIZE && !_contradiction; ++cell)
+    {
+        if (_values[cell] == 0 && __builtin_popcountll(_candidates[cell]) == 1)
+        {
+            assign(cell, __builtin_ctzll(_candidates[cell]) + 1);
+            progress = true;
+        }
+    }
+    return progress;
+}
+
+// Números que solo caben en una celda de una unidad: coloca los de todas las unidades en una pasada
+bool SudokuGrader::hidden_single()
+{
+    bool progress = false;
+    for (int u = 0; u < 3 * _BOARD_SIZE && !_contradiction; ++u)
+    {
+        PeerTable::CellRange unit = _table->unit(u);
+        Mask once = 0, twice = 0, placed = 0;
+        for (int cell : unit)
+        {
+            if (_values[cell] != 0) { placed |= Mask(1) << (_values[cell] - 1); continue; }
+            twice |= once & _candidates[cell];
+            once |= _candidates[cell];
+        }
+
+        Mask full = (_BOARD_SIZE == 64) ? ~Mask(0) : ((Mask(1) << _BOARD_SIZE) - 1);
+        if ((once | placed) != full) { _contradiction = true; break; }   // Algún número no cabe en la unidad
+
+        Mask singles = once & ~twice;
+        if (!singles) { continue; }
+        for (int cell : unit)
+        {
+            if (_values[cell] == 0 && (_candidates[cell] & singles))
+            {
+                assign(cell, __builtin_ctzll(_candidates[cell] & singles) + 1);
+            }
+        }
+        progress = true;
+    }
+    return progress;
+}
+
+// Candidatos bloqueados: "pointing" (caja -> línea) y "claiming" (línea -> caja). Un segmento es la intersección
+// de una fila (o columna) con una caja: un número que dentro de su caja solo está en un segmento sale del resto de
+// la línea, y uno que dentro de su línea solo está en un segmento sale del resto de la caja. Las máscaras de los
+// segmentos tratan todos los números a la vez
+bool SudokuGrader::locked_candidates()
+{
+    const int N = _BOARD_SIZE;
+    const int B = _BOX_SIZE;
+
+    // segments[0][row * B + c]: candidatos de la fila en la columna de cajas c; segments[1][col * B + r]: de la
+    // columna en la fila de cajas r (las celdas rellenas no tienen candidatos)
+    Mask segments[2][BitBoard::MAX_BOARD_SIZE * 8];
+    std::fill(segments[0], segments[0] + N * B, Mask(0));
+    std::fill(segments[1], segments[1] + N * B, Mask(0));
+    for (int cell = 0; cell < N * N; ++cell)
+    {
+        int row = _table->row_of(cell), col = _table->col_of(cell);
+        segments[0][row * B + col / B] |= _candidates[cell];
+        segments[1][col * B + row / B] |= _candidates[cell];
+    }
+
+    bool progress = false;
+    for (int byColumns = 0; byColumns < 2; ++byColumns)
+    {
+        const Mask* segment = segments[byColumns];
+        auto position = [&](int cell) { return byColumns ? _table->row_of(cell) : _table->col_of(cell); };
+        auto line_of = [&](int cell) { return byColumns ? _table->col_of(cell) : _table->row_of(cell); };
+
+        // Pointing: en la caja (band, s) se comparan sus B segmentos, uno por línea de la banda
+        for (int band = 0; band < B; ++band)
+        {
+            for (int s = 0; s < B; ++s)
+            {
+                Mask once = 0, twice = 0;
+                for (int i = 0; i < B; ++i)
+                {
+                    Mask m = segment[(band * B + i) * B + s];
+                    twice |= once & m;
+                    once |= m;
+                }
+                for (int i = 0; i < B; ++i)
+                {
+                    Mask only = segment[(band * B + i) * B + s] & ~twice;
+                    if (!only) { continue; }
+                    for (int cell : _table->unit(byColumns * N + band * B + i))
+                    {
+                        if (position(cell) / B != s) { progress |= eliminate(cell, only); }
+                    }
+                }
+            }
+        }
+
+        // Claiming: en la línea se comparan sus B segmentos, uno por caja que la cruza
+        for (int line = 0; line < N; ++line)
+        {
+            Mask once = 0, twice = 0;
+            for (int s = 0; s < B; ++s)
+            {
+                Mask m = segment[line * B + s];
+                twice |= once & m;
+                once |= m;
+            }
+            int band = line / B;
+            for (int s = 0; s < B; ++s)
+            {
+                Mask only = segment[line * B + s] & ~twice;
+                if (!only) { continue; }
+                int box = byColumns ? s * B + band : band * B + s;
+                for (int cell : _table->unit(2 * N + box))
+                {
+                    if (line_of(cell) != line) { progress |= eliminate(cell, only); }
+                }
+            }
+        }
+    }
+    return progress;
+}
+
+// Pares desnudos: dos celdas de la unidad con los mismos dos candidatos
+bool SudokuGrader::naked_pair()
+{
+    bool progress = false;
+    for (int u = 0; u < 3 * _BOARD_SIZE; ++u)
+    {
+        PeerTable::CellRange unit = _table->unit(u);
+        for (int i = 0; i < unit.size(); ++i)
+        {
+            Mask pair = _candidates[unit[i]];
+            if (__builtin_popcountll(pair) != 2) { continue; }
+            for (int j = i + 1; j < unit.size(); ++j)
+            {
+                if (_candidates[unit[j]] != pair) { continue; }
+                for (int k = 0; k < unit.size(); ++k)
+                {
+                    if (k != i && k != j) { progress |= eliminate(unit[k], pair); }
+                }
+            }
+        }
+        if (progress) { return true; }
+    }
+    return false;
+}
+
+// Pares ocultos: dos números que solo caben en las mismas dos celdas de la unidad
+bool SudokuGrader::hidden_pair()
+{
+    const int N = _BOARD_SIZE;
+    Mask positions[BitBoard::MAX_BOARD_SIZE];
+    bool progress = false;
+    for (int u = 0; u < 3 * N; ++u)
+    {
+        PeerTable::CellRange unit = _table->unit(u);
+        // positions[num - 1]: bit k activo si el número cabe en la k-ésima celda de la unidad
+        for (int num = 0; num < N; ++num) { positions[num] = 0; }
+        for (int k = 0; k < N; ++k)
+        {
+            for (Mask m = _candidates[unit[k]]; m; m &= m - 1)
+            {
+                positions[__builtin_ctzll(m)] |= Mask(1) << k;
+            }
+        }
+
+        for (int a = 0; a < N; ++a)
+        {
+            if (__builtin_popcountll(positions[a]) != 2) { continue; }
+            for (int b = a + 1; b < N; ++b)
+            {
+                if (positions[b] != positions[a]) { continue; }
+                Mask keep = (Mask(1) << a) | (Mask(1) << b);
+                for (Mask m = positions[a]; m; m &= m - 1)
+                {
+                    int cell = unit[__builtin_ctzll(m)];
+                    progress |= eliminate(cell, _candidates[cell] & ~keep);
+                }
+            }
+        }
+        if (progress) { return true; }
+    }
+    return false;
+}
+
+// Tríos desnudos: tres celdas de la unidad cuyos candidatos suman tres números
+bool SudokuGrader::naked_triple()
+{
+    int small[BitBoard::MAX_BOARD_SIZE];   // Celdas de la unidad con 2 o 3 candidatos
+    bool progress = false;
+    for (int u = 0; u < 3 * _BOARD_SIZE; ++u)
+    {
+        PeerTable::CellRange unit = _table->unit(u);
+        int numSmall = 0;
+        for (int cell : unit)
+        {
+            int count = __builtin_popcountll(_candidates[cell]);
+            if (count == 2 || count == 3) { small[numSmall++] = cell; }
+        }
+
+        for (int i = 0; i < numSmall; ++i)
+        {
+            for (int j = i + 1; j < numSmall; ++j)
+            {
+                Mask ij = _candidates[small[i]] | _candidates[small[j]];
+                if (__builtin_popcountll(ij) > 3) { continue; }
+                for (int k = j + 1; k < numSmall; ++k)
+                {
+                    Mask triple = ij | _candidates[small[k]];
+                    if (__builtin_popcountll(triple) != 3) { continue; }
+                    for (int cell : unit)
+                    {
+                        if (cell != small[i] && cell != small[j] && cell != small[k]) { progress |= eliminate(cell, triple); }
+                    }
+                }
+            }
+        }
+        if (progress) { return true; }
+    }
+    return false;
+}
+
+// X-Wing por filas y por columnas
+bool SudokuGrader::x_wing()
+{
+    const int N = _BOARD_SIZE;
+    Mask positions[BitBoard::MAX_BOARD_SIZE];
+    for (int num = 1; num <= N; ++num)
+    {
+        Mask bit = Mask(1) << (num - 1);
+        for (int byColumns = 0; byColumns < 2; ++byColumns)
+        {
+            // positions[line]: posiciones del número dentro de cada fila (o columna)
+            for (int line = 0; line < N; ++line)
+            {
+                positions[line] = 0;
+                PeerTable::CellRange unit = _table->unit(byColumns * N + line);
+                for (int k = 0; k < N; ++k)
+                {
+                    if (_candidates[unit[k]] & bit) { positions[line] |= Mask(1) << k; }
+                }
+            }
+
+            bool progress = false;
+            for (int a = 0; a < N; ++a)
+            {
+                if (__builtin_popcountll(positions[a]) != 2) { continue; }
+                for (int b = a + 1; b < N; ++b)
+                {
+                    if (positions[b] != positions[a]) { continue; }
+                    // El número queda fijado a esas dos posiciones: se elimina del resto de sus líneas cruzadas
+                    for (Mask m = positions[a]; m; m &= m - 1)
+                    {
+                        PeerTable::CellRange cross = _table->unit((1 - byColumns) * N + __builtin_ctzll(m));
+                        for (int k = 0; k < N; ++k)
+                        {
+                            if (k != a && k != b) { progress |= eliminate(cross[k], bit); }
+                        }
+                    }
+                }
+            }
+            if (progress) { return true; }
+        }
+    }
+    return false;
+}
+
+// Aplica una técnica de la escalera
+bool SudokuGrader::apply(TECHNIQUE technique)
+{
+    switch (technique)
+    {
+        case TECHNIQUE::NAKED_SINGLE:      return naked_single();
+        case TECHNIQUE::HIDDEN_SINGLE:     return hidden_single();
+        case TECHNIQUE::LOCKED_CANDIDATES: return locked_candidates();
+        case TECHNIQUE::NAKED_PAIR:        return naked_pair();
+        case TECHNIQUE::HIDDEN_PAIR:       return hidden_pair();
+        case TECHNIQUE::NAKED_TRIPLE:      return naked_triple();
+        case TECHNIQUE::X_WING:            return x_wing();
+        default:                           return false;
+    }
+}
+
+// Califica el sudoku: aplica siempre la técnica más fácil que avance hasta resolverlo o atascarse
+GradeReport SudokuGrader::grade(const SudokuBoard& board, bool measure_search /*=false*/)
+{
+    GradeReport report;
+    const int N = board.get_board_size();
+    _BOARD_SIZE = N;
+    _BOX_SIZE = board.get_box_size();
+    _contradiction = (N <= 0 || N > BitBoard::MAX_BOARD_SIZE);
+    if (_contradiction) { report.contradiction = true; return report; }
+
+    _table = &PeerTable::get(_BOX_SIZE);   // Unidades y vecinos: tablas compartidas, sin construir nada por llamada
+
+    // Estado inicial: todos los candidatos y luego las pistas
+    Mask full = (N == 64) ? ~Mask(0) : ((Mask(1) << N) - 1);
+    _values.assign(N * N, 0);
+    _candidates.assign(N * N, full);
+    _numEmpty = N * N;
+    for (int cell = 0; cell < N * N && !_contradiction; ++cell)
+    {
+        int num = board.at(cell / N, cell % N);
+        if (num == board.get_empty_cell_value()) { continue; }
+        if (num < board.get_min_value() || num > board.get_max_value() || !(_candidates[cell] & (Mask(1) << (num - 1))))
+        {
+            _contradiction = true;   // Pista fuera de rango o repetida en su unidad
+            break;
+        }
+        assign(cell, num);
+    }
+
+    while (!_contradiction && _numEmpty > 0)
+    {
+        bool progress = false;
+        for (int t = 0; t < NUM_TECHNIQUES - 1 && !progress && !_contradiction; ++t)
+        {
+            TECHNIQUE technique = static_cast<TECHNIQUE>(t);
+            if (apply(technique))
+            {
+                progress = true;
+                report.uses[t]++;
+                if (technique > report.hardest) { report.hardest = technique; }
+            }
+        }
+        if (_contradiction) { break; }   // Sin solución: ninguna técnica ni búsqueda la completará
+        if (!progress)
+        {
+            report.hardest = TECHNIQUE::SEARCH;
+            report.uses[NUM_TECHNIQUES - 1]++;
+            break;
+        }
+    }
+    report.contradiction = _contradiction;
+
+    if (measure_search)
+    {
+        BitBoard bitboard(board);
+        ReferenceSearch search;
+        if (bitboard.is_consistent()) { reference_search(bitboard, search); }
+        report.num_solutions = search.solutions;
+        report.search_nodes = search.nodes;
+        report.search_backtracks = search.backtracks;
+    }
+    return report;
+}
@@ -0,0 +1,88 @@
+#include "SudokuMinimizer.hpp"
+#include "SudokuUniqueness.hpp"
+#include "SudokuTest.hpp"
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <vector>
+#include <omp.h>
+
+// Constructor del minimizador
+SudokuMinimizer::SudokuMinimizer(int num_threads /*=0*/, int batch_size /*=0*/)
+    : _num_threads(num_threads),
+      _batch_size(batch_size)
+{ }
+
+// Minimización por lotes especulativos
+bool SudokuMinimizer::minimize(const SudokuBoard& puzzle, SudokuBoard& minimal, unsigned seed /*=0*/) const
+{
+    // Mismas comprobaciones de validez que se hacen antes de resolver
+    if (!SudokuTest::checkValidBoard(puzzle)) { return false; }
+    if (!has_unique_solution(puzzle)) { return false; }
+
+    int num_threads = (_num_threads > 0) ? _num_threads : omp_get_max_threads();
+    int batch_size = (_batch_size > 0) ? _batch_size : 2 * num_threads;
+
+    int N = puzzle.get_board_size();
+    Board grid = puzzle.get_board_data();
+
+    // Cola de pistas candidatas en orden aleatorio
+    std::vector<int> clues;
+    for (int cell = 0; cell < N * N; ++cell)
+    {
+        if (grid[cell / N][cell % N] != puzzle.get_empty_cell_value()) { clues.push_back(cell); }
+    }
+    std::mt19937 rng(seed);
+    std::shuffle(clues.begin(), clues.end(), rng);
+    std::deque<int> candidates(clues.begin(), clues.end());
+
+    while (!candidates.empty())
+    {
+        // Tomar un lote de candidatas y comprobar cada eliminación por separado, en paralelo
+        std::vector<int> batch;
+        while (!candidates.empty() && (int) batch.size() < batch_size)
+        {
+            batch.push_back(candidates.front());
+            candidates.pop_front();
+        }
+        int numberOfCandidates = batch.size();
+        std::vector<char> removable(numberOfCandidates, 0);
+
+        #pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads) default(none) \
+            shared(grid, batch, removable, numberOfCandidates, N)
+        for (int i = 0; i < numberOfCandidates; ++i)
+        {
+            Board trial = grid;
+            trial[batch[i] / N][batch[i] % N] = 0;
+            removable[i] = has_unique_solution(SudokuBoard(trial));
+        }
+
+        // Las que no se pueden quitar son imprescindibles para siempre; el resto se quita de forma especulativa
+        std::vector<int> accepted;
+        for (int i = 0; i < numberOfCandidates; ++i)
+        {
+            if (removable[i]) { accepted.push_back(batch[i]); }
+        }
+        if (accepted.empty()) { continue; }
+
+        Board speculative = grid;
+        for (int cell : accepted) { speculative[cell / N][cell % N] = 0; }
+
+        if (accepted.size() == 1 || has_unique_solution(SudokuBoard(speculative), num_threads))
+        {
+            grid.swap(speculative);   // Todo el lote es compatible
+        }
+        else
+        {
+            // Conflicto: deshacer el lote, quitar solo la primera pista y volver a encolar las demás
+            grid[accepted[0] / N][accepted[0] % N] = 0;
+            for (std::size_t i = accepted.size() - 1; i >= 1; --i)
+            {
+                candidates.push_front(accepted[i]);
+            }
+        }
+    }
+
+    minimal = SudokuBoard(grid);
+    return true;
+}
@@ -0,0 +1,70 @@
+#include "SudokuParallelProfile.hpp"
+#include "SudokuSolverFactory.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+ParallelConfig ParallelProfile::lookup(MODES mode, int board_size) const
+{
+    auto it = _configs.find({ mode, board_size });
+    return (it != _configs.end()) ? it->second : ParallelConfig();
+}
+
+bool ParallelProfile::load(const std::string& filename)
+{
+    std::ifstream file(filename);
+    if (!file.is_open()) { return false; }
+
+    std::map<std::pair<MODES, int>, ParallelConfig> configs;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (!line.empty() && line.back() == '\r') { line.pop_back(); }
+        if (line.empty() || line[0] == '#') { continue; }   // Comentarios
+
+        std::istringstream fields(line);
+        std::string modeName;
+        int boardSize;
+        ParallelConfig config;
+        if (!(fields >> modeName >> boardSize >> config.num_threads >> config.split_depth >> config.kernel
+                     >> config.frontier_size >> config.task_cutoff)) { return false; }
+
+        MODES mode;
+        if (!parse_mode(modeName, mode)) { return false; }
+        configs[{ mode, boardSize }] = config;
+    }
+    _configs.swap(configs);
+    return true;
+}
+
+bool ParallelProfile::save(const std::string& filename) const
+{
+    std::ofstream file(filename);
+    if (!file.is_open()) { return false; }
+
+    file << "# modo tamaño hilos split_depth kernel frontier_size task_cutoff\n";
+    for (const auto& entry : _configs)
+    {
+        const ParallelConfig& config = entry.second;
+        file << to_string(entry.first.first) << " " << entry.first.second << " " << config.num_threads << " "
+             << config.split_depth << " " << config.kernel << " " << config.frontier_size << " " << config.task_cutoff << "\n";
+    }
+    return file.good();
+}
+
+std::string ParallelProfile::default_file_name()
+{
+    const char* name = std::getenv("SUDOKU_PARALLEL_PROFILE");
+    return (name != nullptr && name[0] != '\0') ? std::string(name) : std::string("parallel_profile.txt");
+}
+
+const ParallelProfile& ParallelProfile::get()
+{
+    // La inicialización de una variable estática local es segura entre hilos (C++11)
+    static const ParallelProfile profile = [] {
+        ParallelProfile p;
+        if (!p.load(default_file_name())) { p = ParallelProfile(); }
+        return p;
+    }();
+    return profile;
+}
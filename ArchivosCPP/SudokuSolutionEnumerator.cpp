@@ -0,0 +1,330 @@
+#include "SudokuSolutionEnumerator.hpp"
+#include "SudokuSolver_SequentialDLX.hpp"
+#include "FileUtils.hpp"
+#include <cstdio>
+#include <fstream>
+#include <variant>
+
+namespace {
+
+// Escribe la cabecera del punto de control: tipo de enumerador, versión y tablero de partida
+void write_header(std::ostream& out, const char* kind, const SudokuBoard& board)
+{
+    const int N = board.get_board_size();
+    out << kind << " " << CHECKPOINT_VERSION << " " << N << "\n";
+    for (int row = 0; row < N; ++row)
+    {
+        for (int col = 0; col < N; ++col) { out << (col ? " " : "") << board.at(row, col); }
+        out << "\n";
+    }
+}
+
+// Lee la cabecera y comprueba que el punto de control es de este enumerador y de este tablero
+bool read_header(std::istream& in, const char* kind, const SudokuBoard& board)
+{
+    std::string fileKind;
+    int version, N;
+    if (!(in >> fileKind >> version >> N) || fileKind != kind || version != CHECKPOINT_VERSION
+        || N != board.get_board_size()) { return false; }
+
+    for (int row = 0; row < N; ++row)
+    {
+        for (int col = 0; col < N; ++col)
+        {
+            int value;
+            if (!(in >> value) || value != board.at(row, col)) { return false; }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+// ====================== DLXSolutionEnumerator ======================
+
+// Constructor: copia la plantilla del tamaño del tablero y cubre las pistas
+DLXSolutionEnumerator::DLXSolutionEnumerator(const SudokuBoard& board)
+    : _board(board),
+      _solution(board),
+      _dlx(DLXTemplate::get(board.get_board_size()))
+{
+    _finished = !_dlx.coverGivens(board);
+    _columns.reserve(board.get_init_num_empty_cells());
+    _rows.reserve(board.get_init_num_empty_cells());
+}
+
+// Formato: cabecera, "finished backtrackFirst numSolutions depth" y los nodos de las filas elegidas
+bool DLXSolutionEnumerator::write_checkpoint(const std::string& filename, bool backtrackFirst) const
+{
+    std::string tmpFilename = filename + ".tmp";
+    {
+        std::ofstream file(tmpFilename, std::ios::trunc);
+        if (!file.is_open()) { return false; }
+        write_header(file, "DLX", _board);
+        file << _finished << " " << backtrackFirst << " " << _numSolutions << " " << _rows.size() << "\n";
+        for (std::size_t i = 0; i < _rows.size(); ++i) { file << (i ? " " : "") << _rows[i]; }
+        file << "\n";
+        if (!file.good()) { file.close(); std::remove(tmpFilename.c_str()); return false; }
+    }
+    return replace_file(tmpFilename, filename);
+}
+
+// Repite las filas guardadas en el mismo orden que la búsqueda original. En cada nivel la columna tiene
+// que ser la que elige la heurística y la fila tiene que estar en ella; si no, el archivo no es de esta búsqueda.
+bool DLXSolutionEnumerator::load_checkpoint(const std::string& filename)
+{
+    if (_started || _finished) { return false; }
+    std::ifstream file(filename);
+    if (!file.is_open() || !read_header(file, "DLX", _board)) { return false; }
+
+    bool finished, backtrackFirst;
+    long long numSolutions;
+    int depth;
+    if (!(file >> finished >> backtrackFirst >> numSolutions >> depth)
+        || depth < 0 || depth > _board.get_board_size() * _board.get_board_size()) { return false; }
+
+    for (int level = 0; level < depth; ++level)
+    {
+        int r;
+        if (!(file >> r) || _dlx.empty()) { SudokuSolver_SequentialDLX::unwind(_dlx, _rows, _columns); return false; }
+        int c = _dlx.selectColumn();
+        int n = _dlx.down(c);
+        while (n != c && n != r) { n = _dlx.down(n); }
+        if (n == c) { SudokuSolver_SequentialDLX::unwind(_dlx, _rows, _columns); return false; }
+
+        _dlx.cover(c);
+        _columns.push_back(c);
+        _rows.push_back(r);
+        _dlx.coverRow(r);
+    }
+
+    _finished = finished;
+    _started = backtrackFirst;
+    _numSolutions = numSolutions;
+    return true;
+}
+
+// Versión iterativa de solve_kernel que se detiene en cada solución
+bool DLXSolutionEnumerator::next()
+{
+    if (_finished) { return false; }
+    if (_started && !SudokuSolver_SequentialDLX::backtrack(_dlx, _rows, _columns, nullptr))   // Continuar después de la solución anterior
+    {
+        _finished = true;
+        return false;
+    }
+    _started = true;
+
+    while (true)
+    {
+        // El estado al principio de cada iteración es el de un descenso pendiente
+        if (_checkpoint.due()) { write_checkpoint(_checkpoint.filename(), false); }
+
+        if (_dlx.empty())
+        {
+            for (int r : _rows) { _dlx.applyToBoard(r, _solution); }
+            ++_numSolutions;
+            return true;
+        }
+
+        int c = _dlx.selectColumn();
+        _dlx.cover(c);
+        int r = _dlx.down(c);
+        if (r == c)   // Restricción imposible de satisfacer: retroceder
+        {
+            _dlx.uncover(c);
+            if (!SudokuSolver_SequentialDLX::backtrack(_dlx, _rows, _columns, nullptr))
+            {
+                _finished = true;
+                return false;
+            }
+            continue;
+        }
+
+        _columns.push_back(c);
+        _rows.push_back(r);
+        _dlx.coverRow(r);
+    }
+}
+
+// ====================== BitBoardSolutionEnumerator ======================
+
+// Constructor: carga las pistas en el tablero de bits del tamaño de caja del puzle
+BitBoardSolutionEnumerator::BitBoardSolutionEnumerator(const SudokuBoard& board)
+    : _board(board),
+      _solution(board),
+      _bitboard(make_bitboard(board))
+{
+    std::visit([this](auto& bitboard) {
+        _finished = !bitboard.is_consistent();
+        _stack.reserve(bitboard.get_num_empty_cells());
+    }, _bitboard);
+}
+
+// Quita el número del nivel más profundo y coloca su siguiente candidato; si no quedan candidatos,
+// devuelve la celda a la lista de vacías y sube un nivel
+template <class Bitboard>
+bool BitBoardSolutionEnumerator::backtrack(Bitboard& bitboard)
+{
+    while (!_stack.empty())
+    {
+        ChoicePoint& top = _stack.back();
+        bitboard.remove(top.cell, top.num);
+
+        if (top.remaining)
+        {
+            std::uint64_t bit = top.remaining & (~top.remaining + 1);
+            top.remaining ^= bit;
+            top.num = __builtin_ctzll(bit) + 1;
+            bitboard.place(top.cell, top.num);
+            return true;
+        }
+
+        bitboard.restore_cell();
+        _stack.pop_back();
+    }
+    return false;
+}
+
+// Quita todos los números de la pila en orden inverso
+template <class Bitboard>
+void BitBoardSolutionEnumerator::unwind(Bitboard& bitboard)
+{
+    while (!_stack.empty())
+    {
+        bitboard.remove(_stack.back().cell, _stack.back().num);
+        bitboard.restore_cell();
+        _stack.pop_back();
+    }
+}
+
+// Formato: cabecera, "finished backtrackFirst numSolutions depth", el orden de la lista de vacías del tablero de
+// bits y una línea "celda número candidatos" por nivel
+bool BitBoardSolutionEnumerator::write_checkpoint(const std::string& filename, bool backtrackFirst) const
+{
+    std::string tmpFilename = filename + ".tmp";
+    {
+        std::ofstream file(tmpFilename, std::ios::trunc);
+        if (!file.is_open()) { return false; }
+        write_header(file, "BITBOARD", _board);
+        file << _finished << " " << backtrackFirst << " " << _numSolutions << " " << _stack.size() << "\n";
+        std::vector<int> order = std::visit([](const auto& bitboard) { return bitboard.get_empty_order(); }, _bitboard);
+        file << order.size();
+        for (int cell : order) { file << " " << cell; }
+        file << "\n";
+        for (const ChoicePoint& choice : _stack)
+        {
+            file << choice.cell << " " << choice.num << " " << (unsigned long long)choice.remaining << "\n";
+        }
+        if (!file.good()) { file.close(); std::remove(tmpFilename.c_str()); return false; }
+    }
+    return replace_file(tmpFilename, filename);
+}
+
+// Restaura el orden de la lista de vacías y repite los puntos de elección guardados: cada nivel vuelve a tomar
+// la celda en la misma posición, el número tiene que ser candidato y los que quedan, candidatos mayores
+template <class Bitboard>
+bool BitBoardSolutionEnumerator::replay(Bitboard& bitboard, std::istream& file, int depth)
+{
+    if (depth > bitboard.get_num_empty_cells()) { return false; }
+
+    std::size_t orderSize;
+    if (!(file >> orderSize) || orderSize != (std::size_t)bitboard.get_num_empty_cells()) { return false; }
+    std::vector<int> order(orderSize);
+    for (int& cell : order) { if (!(file >> cell)) { return false; } }
+    std::vector<int> initialOrder = bitboard.get_empty_order();
+    if (!bitboard.set_empty_order(order)) { return false; }
+
+    for (int level = 0; level < depth; ++level)
+    {
+        ChoicePoint choice;
+        unsigned long long remaining;
+        if (!(file >> choice.cell >> choice.num >> remaining) || choice.num < 1
+            || choice.num > bitboard.get_board_size())
+        {
+            unwind(bitboard);
+            bitboard.set_empty_order(initialOrder);
+            return false;
+        }
+        choice.remaining = remaining;
+
+        int cell = bitboard.retake_cell();
+        std::uint64_t cellCandidates = bitboard.candidates(cell);
+        std::uint64_t bit = std::uint64_t(1) << (choice.num - 1);
+        std::uint64_t notGreater = bit | (bit - 1);
+        if (cell != choice.cell || !(cellCandidates & bit) || (choice.remaining & ~cellCandidates)
+            || (choice.remaining & notGreater))
+        {
+            bitboard.restore_cell();
+            unwind(bitboard);
+            bitboard.set_empty_order(initialOrder);
+            return false;
+        }
+        bitboard.place(choice.cell, choice.num);
+        _stack.push_back(choice);
+    }
+    return true;
+}
+
+bool BitBoardSolutionEnumerator::load_checkpoint(const std::string& filename)
+{
+    if (_started || _finished) { return false; }
+    std::ifstream file(filename);
+    if (!file.is_open() || !read_header(file, "BITBOARD", _board)) { return false; }
+
+    bool finished, backtrackFirst;
+    long long numSolutions;
+    int depth;
+    if (!(file >> finished >> backtrackFirst >> numSolutions >> depth) || depth < 0) { return false; }
+    if (!std::visit([&](auto& bitboard) { return replay(bitboard, file, depth); }, _bitboard)) { return false; }
+
+    _finished = finished;
+    _started = backtrackFirst;
+    _numSolutions = numSolutions;
+    return true;
+}
+
+// Versión iterativa del backtracking que se detiene en cada solución
+template <class Bitboard>
+bool BitBoardSolutionEnumerator::search(Bitboard& bitboard)
+{
+    if (_started && !backtrack(bitboard)) { return false; }
+    _started = true;
+
+    while (true)
+    {
+        if (_checkpoint.due()) { write_checkpoint(_checkpoint.filename(), false); }
+
+        if (bitboard.get_num_empty_cells() == 0)
+        {
+            bitboard.write_to(_solution);
+            return true;
+        }
+
+        typename Bitboard::Mask cellCandidates = 0;
+        int cell = bitboard.take_cell(cellCandidates);
+        if (!cellCandidates)   // Celda sin candidatos: retroceder
+        {
+            bitboard.restore_cell();
+            if (!backtrack(bitboard)) { return false; }
+            continue;
+        }
+
+        typename Bitboard::Mask bit = cellCandidates & (~cellCandidates + 1);
+        ChoicePoint choice = { cell, Bitboard::lowest(bit) + 1, cellCandidates ^ bit };
+        bitboard.place(choice.cell, choice.num);
+        _stack.push_back(choice);
+    }
+}
+
+bool BitBoardSolutionEnumerator::next()
+{
+    if (_finished) { return false; }
+    if (!std::visit([this](auto& bitboard) { return search(bitboard); }, _bitboard))
+    {
+        _finished = true;
+        return false;
+    }
+    ++_numSolutions;
+    return true;
+}
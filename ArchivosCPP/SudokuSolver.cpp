@@ -1,30 +1,17 @@
 #include "SudokuSolver.hpp"
 #include "helper.hpp"
-#include <algorithm>
-#include <cmath>
-#include <vector>
-#include <thread>
 #include <chrono>
 
 // Constructor de SudokuSolver que inicializa el tablero.
 SudokuSolver::SudokuSolver(SudokuBoard& board)
-	: _board(board) // Inicializa el tablero asociado al solucionador
+	: _board(board), // Inicializa el tablero asociado al solucionador
+	  _peerTable(&PeerTable::get(board.get_box_size()))
 { }
 
 // Verifica si todas las celdas del tablero están llenas.
 bool SudokuSolver::checkIfAllFilled(const SudokuBoard& board) const
 {
-    for (int i = 0; i < board.get_board_size(); ++i)
-	{
-        for (int j = 0; j < board.get_board_size(); ++j)
-		{
-            if (isEmpty(board, i, j)) // Comprueba si hay celdas vacías
-			{
-                return false; // Retorna falso si hay celdas vacías
-			}
-        }
-    }
-    return true; // Retorna verdadero si todas las celdas están llenas
+    return board.is_full(); // El tablero lleva la cuenta de sus celdas vacías
 }
 
 // Verifica si una fila específica está completamente llena.
@@ -87,9 +74,12 @@ bool SudokuSolver::isEmpty(const SudokuBoard& board, int i, int j) const
 // Verifica si un número se puede colocar en una fila específica.
 bool SudokuSolver::isValidRow(const SudokuBoard& board, int num, Position pos) const
 {
-    for (int i = 0; i < board.get_board_size(); ++i)
+	if (board.at(pos.first, pos.second) != num) { return !board.row_contains(pos.first, num); } // Máscara de la fila
+
+	const PeerTable& table = peer_table(board);
+	for (int peer : table.row_peers(pos.first * board.get_board_size() + pos.second))
 	{
-        if ( (i != pos.second) && (board.at(pos.first, i) == num) ) { return false; } // Retorna falso si el número ya existe en la fila
+		if (board.at(pos.first, table.col_of(peer)) == num) { return false; } // Retorna falso si el número ya existe en la fila
 	}
 
 	return true; // Retorna verdadero si el número se puede colocar en la fila
@@ -98,87 +88,80 @@ bool SudokuSolver::isValidRow(const SudokuBoard& board, int num, Position pos) c
 // Verifica si un número se puede colocar en una columna específica.
 bool SudokuSolver::isValidColumn(const SudokuBoard& board, int num, Position pos) const
 {
-	for (int i = 0; i < board.get_board_size(); ++i)
+	if (board.at(pos.first, pos.second) != num) { return !board.col_contains(pos.second, num); } // Máscara de la columna
+
+	const PeerTable& table = peer_table(board);
+	for (int peer : table.column_peers(pos.first * board.get_board_size() + pos.second))
 	{
-        if ( (i != pos.first) && (board.at(i, pos.second) == num) ) { return false; } // Retorna falso si el número ya existe en la columna
+		if (board.at(table.row_of(peer), pos.second) == num) { return false; } // Retorna falso si el número ya existe en la columna
 	}
 	
 	return true; // Retorna verdadero si el número se puede colocar en la columna
 }
 
-// Verifica si un número se puede colocar en el cuadro correspondiente.
+// Verifica si un número se puede colocar en el cuadro correspondiente (las celdas del cuadro fuera de su fila y columna).
 bool SudokuSolver::isValidBox(const SudokuBoard& board, int num, Position pos) const
 {
-	int BOX_SIZE = board.get_box_size();
-
-	int box_x = std::floor(pos.first / board.get_box_size());
-    int box_y = std::floor(pos.second / board.get_box_size());
-
-    for (int i = box_x * BOX_SIZE; i < box_x * BOX_SIZE + BOX_SIZE; ++i)
+	const PeerTable& table = peer_table(board);
+	for (int peer : table.box_peers(pos.first * board.get_board_size() + pos.second))
 	{
-        for (int j = box_y * BOX_SIZE; j < box_y * BOX_SIZE + BOX_SIZE; ++j)
-		{
-            if ( (i != pos.first && j != pos.second) && (board.at(i, j) == num) ) { return false; } // Retorna falso si el número ya existe en el cuadro
-        }
-    }
+		if (board.at(table.row_of(peer), table.col_of(peer)) == num) { return false; } // Retorna falso si el número ya existe en el cuadro
+	}
 
 	return true; // Retorna verdadero si el número se puede colocar en el cuadro
 }
 
-// Verifica si un número se puede colocar en una posición específica (fila, columna).
+// Verifica si un número se puede colocar en una posición específica (fila, columna): ningún vecino lo tiene.
 bool SudokuSolver::isValid(const SudokuBoard& board, int num, Position pos) const
 {
-    return isValidRow(board, num, pos) && isValidColumn(board, num, pos) && isValidBox(board, num, pos); // Verifica las tres condiciones
+	return board.can_place(pos.first, pos.second, num); // Máscaras de fila, columna y cuadro del tablero
 }
 
 // Verifica si un número es único en su cuadro, fila y columna.
 bool SudokuSolver::isUnique(const SudokuBoard& board, int num, Position pos) const
 {
-	int local_row = pos.first % board.get_box_size();
-	int local_col = pos.second % board.get_box_size();
-
-	int box_x = std::floor(pos.first / board.get_box_size());
-    int box_y = std::floor(pos.second / board.get_box_size());
+	int BOX_SIZE = board.get_box_size();
+	int first_row = pos.first - pos.first % BOX_SIZE;
+	int first_col = pos.second - pos.second % BOX_SIZE;
 
-	for (int i = ((local_row == 0) ? 1 : 0); i < board.get_box_size(); ++i)
+	for (int row = first_row; row < first_row + BOX_SIZE; ++row)
 	{
-		if (i == local_row) { continue; } // Salta la fila actual
-		std::vector<int> numbersInRow = board.getNumbersInRow(box_x * board.get_box_size() + i);
-		if (std::find(numbersInRow.begin(), numbersInRow.end(), num) == numbersInRow.end())
-		{
-			return false; // Retorna falso si el número no está en la fila
-		}
+		if (row == pos.first) { continue; } // Salta la fila actual
+		if (!board.row_contains(row, num)) { return false; } // Retorna falso si el número no está en la fila
 	}
 
-	for (int j = ((local_col == 0) ? 1 : 0); j < board.get_box_size(); ++j)
+	for (int col = first_col; col < first_col + BOX_SIZE; ++col)
 	{
-		if (j == local_col) { continue; } // Salta la columna actual
-		std::vector<int> numbersInCol = board.getNumbersInCol(box_y * board.get_box_size() + j);
-		if (std::find(numbersInCol.begin(), numbersInCol.end(), num) == numbersInCol.end())
-		{
-			return false; // Retorna falso si el número no está en la columna
-		}
+		if (col == pos.second) { continue; } // Salta la columna actual
+		if (!board.col_contains(col, num)) { return false; } // Retorna falso si el número no está en la columna
 	}
 
 	return true; // Retorna verdadero si el número es único
 }
 
-// Muestra una barra de progreso durante la solución del Sudoku.
-void SudokuSolver::show_progress_bar(SudokuBoard& board, int _recursionDepth, int interval /*=5*/)
+// Resuelve dentro de los límites dados y resume el resultado.
+SolveResult SudokuSolver::solve_with_options(const SolveOptions& options)
 {
-	if (_recursionDepth == 0)
-	{
-		_current_num_empty_cells = board.get_init_num_empty_cells();
-		printProgressBar2(double(board.get_init_num_empty_cells() - _current_num_empty_cells) / board.get_init_num_empty_cells());
-		std::this_thread::sleep_for(std::chrono::milliseconds(interval)); // Espera antes de mostrar el progreso
-	} 
-	else
-	{
-		if (board.get_num_empty_cells() < _current_num_empty_cells)
-		{
-			_current_num_empty_cells = board.get_num_empty_cells();
-			printProgressBar2(double(board.get_init_num_empty_cells() - _current_num_empty_cells) / board.get_init_num_empty_cells());
-			std::this_thread::sleep_for(std::chrono::milliseconds(interval)); // Espera antes de mostrar el progreso
-		}
-	}
+	auto start = std::chrono::steady_clock::now();
+	_own_budget.reset(options);
+	_budget = options.is_limited() ? &_own_budget : nullptr; // Sin límites los kernels no cuentan nodos
+	solve();
+	_budget = nullptr;
+
+	SolveResult result;
+	result.elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	result.stats = _stats;
+	result.nodes = options.is_limited() ? _own_budget.nodes() : _stats.nodes();
+	if (_solved) { result.status = SOLVE_STATUS::SOLVED; }
+	else if (_own_budget.exhausted()) { result.status = _own_budget.status(); }
+	else { result.status = SOLVE_STATUS::NO_SOLUTION; }
+	return result;
+}
+
+// Arranca la barra de progreso en su propio hilo (nullptr si no se muestra).
+std::unique_ptr<ProgressReporter> SudokuSolver::start_progress_reporter()
+{
+	_progress.store(0, std::memory_order_relaxed);
+	if (!_show_progress) { return nullptr; }
+	return std::unique_ptr<ProgressReporter>(new ProgressReporter(_progress, _board.get_init_num_empty_cells()));
 }
@@ -0,0 +1,286 @@
+#include "SudokuSolverFactory.hpp"
+#include "SudokuSolver_SequentialBacktracking.hpp"
+#include "SudokuSolver_SequentialBruteForce.hpp"
+#include "SudokuSolver_ParallelBruteForce.hpp"
+#include "SudokuSolver_SequentialDLX.hpp"
+#include "SudokuSolver_ParallelDLX.hpp"
+#include "SudokuSolver_SequentialForwardChecking.hpp"
+#include "SudokuSolver_SequentialBitboard.hpp"
+#include "BitBoard.hpp"
+#include "termcolor.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace {
+
+// Límites superiores (exclusivos) de los grupos, salvo el último que no tiene límite
+const double CLUE_BUCKET_EDGES[SolverDispatchTable::NUM_CLUE_BUCKETS - 1] = { 0.25, 0.35, 0.45 };
+const double DENSITY_BUCKET_EDGES[SolverDispatchTable::NUM_DENSITY_BUCKETS - 1] = { 0.25, 0.40, 0.55 };
+
+// Nombres de los modos, en el orden de MODES
+const char* MODE_NAMES[] = {
+    "SEQUENTIAL_BACKTRACKING",
+    "SEQUENTIAL_BRUTEFORCE",
+    "PARALLEL_BRUTEFORCE",
+    "SEQUENTIAL_DANCINGLINKS",
+    "PARALLEL_DANCINGLINKS",
+    "SEQUENTIAL_FORWARDCHECKING",
+    "SEQUENTIAL_BITBOARD",
+    "AUTO"
+};
+
+const char* PROPAGATION_NAMES[] = { "SOLVED", "STUCK", "CONTRADICTION" };
+
+int bucket_index(double value, const double* edges, int numBuckets)
+{
+    int bucket = 0;
+    while (bucket < numBuckets - 1 && value >= edges[bucket]) { ++bucket; }
+    return bucket;
+}
+
+double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    std::size_t n = values.size();
+    return (n % 2 == 1) ? values[n / 2] : 0.5 * (values[n / 2 - 1] + values[n / 2]);
+}
+
+}
+
+// Una pasada por las celdas para las pistas y la densidad de candidatos, y después se colocan
+// repetidamente las celdas con un único candidato hasta que no quede ninguna
+PuzzleFeatures compute_features(const SudokuBoard& board)
+{
+    PuzzleFeatures features;
+    const int N = board.get_board_size();
+    features.board_size = N;
+    features.num_clues = board.get_num_total_cells() - board.get_num_empty_cells();
+    features.clue_ratio = (N > 0) ? double(features.num_clues) / (N * N) : 0.0;
+
+    BitBoard bitboard(board);
+    if (N > BitBoard::MAX_BOARD_SIZE || !bitboard.is_consistent())
+    {
+        features.candidate_density = 1.0;
+        features.propagation = (N > BitBoard::MAX_BOARD_SIZE) ? PROPAGATION::STUCK : PROPAGATION::CONTRADICTION;
+        features.empty_after_propagation = 1.0 - features.clue_ratio;
+        return features;
+    }
+
+    std::vector<int> empty;
+    long long totalCandidates = 0;
+    for (int cell = 0; cell < N * N; ++cell)
+    {
+        if (bitboard.at(cell) != 0) { continue; }
+        empty.push_back(cell);
+        totalCandidates += __builtin_popcountll(bitboard.candidates(cell));
+    }
+    features.candidate_density = empty.empty() ? 0.0 : double(totalCandidates) / (double(empty.size()) * N);
+
+    // Propagación de singles desnudos
+    bool progress = true;
+    while (progress && features.propagation == PROPAGATION::STUCK)
+    {
+        progress = false;
+        for (std::size_t i = 0; i < empty.size(); )
+        {
+            BitBoard::Mask m = bitboard.candidates(empty[i]);
+            if (m == 0) { features.propagation = PROPAGATION::CONTRADICTION; break; }
+            if (__builtin_popcountll(m) == 1)
+            {
+                bitboard.place(empty[i], __builtin_ctzll(m) + 1);
+                empty[i] = empty.back();
+                empty.pop_back();
+                progress = true;
+                continue;
+            }
+            ++i;
+        }
+        if (empty.empty() && features.propagation == PROPAGATION::STUCK) { features.propagation = PROPAGATION::SOLVED; }
+    }
+    features.empty_after_propagation = double(empty.size()) / (N * N);
+    return features;
+}
+
+std::string to_string(MODES mode)
+{
+    return MODE_NAMES[static_cast<int>(mode)];
+}
+
+bool parse_mode(const std::string& name, MODES& mode)
+{
+    for (int i = 0; i <= static_cast<int>(MODES::AUTO); ++i)
+    {
+        if (name == MODE_NAMES[i])
+        {
+            mode = static_cast<MODES>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SolverDispatchTable::Bucket::operator<(const Bucket& other) const
+{
+    if (board_size != other.board_size) { return board_size < other.board_size; }
+    if (clues != other.clues) { return clues < other.clues; }
+    if (density != other.density) { return density < other.density; }
+    return propagation < other.propagation;
+}
+
+SolverDispatchTable::Bucket SolverDispatchTable::bucket_of(const PuzzleFeatures& features)
+{
+    return { features.board_size,
+             bucket_index(features.clue_ratio, CLUE_BUCKET_EDGES, NUM_CLUE_BUCKETS),
+             bucket_index(features.candidate_density, DENSITY_BUCKET_EDGES, NUM_DENSITY_BUCKETS),
+             features.propagation };
+}
+
+MODES SolverDispatchTable::select(const PuzzleFeatures& features) const
+{
+    auto it = _table.find(bucket_of(features));
+    return (it != _table.end()) ? it->second : default_mode(features);
+}
+
+// Sin datos: el backtracking con máscaras de bits es el más rápido hasta 9x9 y cuando la propagación
+// ya decide el tablero; en tableros mayores la elección de columna de DLX poda mucho más
+MODES SolverDispatchTable::default_mode(const PuzzleFeatures& features)
+{
+    if (features.board_size > BitBoard::MAX_BOARD_SIZE) { return MODES::SEQUENTIAL_DANCINGLINKS; }
+    if (features.propagation != PROPAGATION::STUCK || features.board_size <= 9) { return MODES::SEQUENTIAL_BITBOARD; }
+    return MODES::SEQUENTIAL_DANCINGLINKS;
+}
+
+void SolverDispatchTable::record(const PuzzleFeatures& features, MODES mode, double milliseconds)
+{
+    if (mode == MODES::AUTO) { return; }
+    _samples[bucket_of(features)][mode].push_back(milliseconds);
+}
+
+void SolverDispatchTable::learn()
+{
+    for (const auto& bucket : _samples)
+    {
+        double best = 0.0;
+        bool any = false;
+        for (const auto& mode : bucket.second)
+        {
+            if (mode.second.empty()) { continue; }
+            double t = median(mode.second);
+            if (!any || t < best)
+            {
+                best = t;
+                any = true;
+                _table[bucket.first] = mode.first;
+            }
+        }
+    }
+}
+
+bool SolverDispatchTable::load(const std::string& filename)
+{
+    std::ifstream file(filename);
+    if (!file.is_open()) { return false; }
+
+    std::map<Bucket, MODES> table;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (!line.empty() && line.back() == '\r') { line.pop_back(); }
+        if (line.empty() || line[0] == '#') { continue; }   // Comentarios
+
+        std::istringstream fields(line);
+        Bucket bucket;
+        std::string propagation, modeName;
+        if (!(fields >> bucket.board_size >> bucket.clues >> bucket.density >> propagation >> modeName)) { return false; }
+
+        int p = 0;
+        while (p < 3 && propagation != PROPAGATION_NAMES[p]) { ++p; }
+        MODES mode;
+        if (p == 3 || !parse_mode(modeName, mode) || mode == MODES::AUTO) { return false; }
+        bucket.propagation = static_cast<PROPAGATION>(p);
+        table[bucket] = mode;
+    }
+    _table.swap(table);
+    return true;
+}
+
+bool SolverDispatchTable::save(const std::string& filename) const
+{
+    std::ofstream file(filename);
+    if (!file.is_open()) { return false; }
+
+    file << "# tamaño grupo_pistas grupo_densidad propagacion modo\n";
+    for (const auto& rule : _table)
+    {
+        file << rule.first.board_size << " " << rule.first.clues << " " << rule.first.density << " "
+             << PROPAGATION_NAMES[static_cast<int>(rule.first.propagation)] << " " << to_string(rule.second) << "\n";
+    }
+    return file.good();
+}
+
+std::string SolverDispatchTable::default_file_name()
+{
+    const char* name = std::getenv("SUDOKU_DISPATCH_TABLE");
+    return (name != nullptr && name[0] != '\0') ? std::string(name) : std::string("dispatch_table.txt");
+}
+
+const SolverDispatchTable& SolverDispatchTable::get()
+{
+    // La inicialización de una variable estática local es segura entre hilos (C++11)
+    static const SolverDispatchTable table = [] {
+        SolverDispatchTable t;
+        if (!t.load(default_file_name())) { t = SolverDispatchTable(); }
+        return t;
+    }();
+    return table;
+}
+
+std::unique_ptr<SudokuSolver> CreateSudokuSolver(MODES mode, SudokuBoard& board, bool print_message /*=true*/) {
+    switch (mode) {
+        case MODES::SEQUENTIAL_BACKTRACKING:
+            return std::make_unique<SudokuSolver_SequentialBacktracking>(board, print_message);
+
+        case MODES::SEQUENTIAL_BRUTEFORCE:
+            return std::make_unique<SudokuSolver_SequentialBruteForce>(board, print_message);
+
+        case MODES::PARALLEL_BRUTEFORCE:
+            return std::make_unique<SudokuSolver_ParallelBruteForce>(board, print_message);
+
+        case MODES::SEQUENTIAL_DANCINGLINKS:
+            return std::make_unique<SudokuSolver_SequentialDLX>(board, print_message);
+
+        case MODES::PARALLEL_DANCINGLINKS:
+            return std::make_unique<SudokuSolver_ParallelDLX>(board, print_message);
+
+        case MODES::SEQUENTIAL_FORWARDCHECKING:
+            return std::make_unique<SudokuSolver_SequentialForwardChecking>(board, print_message);
+
+        case MODES::SEQUENTIAL_BITBOARD:
+            return std::make_unique<SudokuSolver_SequentialBitboard>(board, print_message);
+
+        case MODES::AUTO: {
+            MODES selected = SolverDispatchTable::get().select(compute_features(board));
+            if (print_message) {
+                std::cout << "\n Modo automatico: se usa " << to_string(selected) << "\n";
+            }
+            return CreateSudokuSolver(selected, board, print_message);
+        }
+
+        default:
+            std::cerr << termcolor::red << "Available options for <MODE>: " << "\n";
+            std::cerr << "    - 0: sequential mode with backtracking algorithm" << "\n";
+            std::cerr << "    - 1: sequential mode with brute force algorithm" << "\n";
+            std::cerr << "    - 2: parallel mode with brute force algorithm" << "\n";
+            std::cerr << "    - 3: sequential mode with DLX algorithm" << "\n";
+            std::cerr << "    - 4: parallel mode with DLX algorithm" << "\n";
+            std::cerr << "    - 5: sequential mode with forward checking algorithm" << "\n";
+            std::cerr << "    - 6: sequential mode with bitboard backtracking algorithm" << "\n";
+            std::cerr << "    - 9: automatic mode (engine chosen from the puzzle features)" << "\n";
+            std::cerr << "Please try again." << termcolor::reset << "\n";
+
+            exit(-1);
+    }
+}
@@ -1,5 +1,6 @@
 #include "SudokuSolver_ParallelBruteForce.hpp" 
 #include "SudokuSolver_SequentialBruteForce.hpp" 
+#include "ParallelTrace.hpp"
 #include "termcolor.hpp"  
 #include <iostream> 
 #include <vector>  
@@ -14,6 +15,55 @@ SudokuSolver_ParallelBruteForce::SudokuSolver_ParallelBruteForce(SudokuBoard& bo
 	{
 		std::cout << "\n" << "Resolviendo el sudoku usando algoritmo fuerza bruta en paralelo porfavor espere mientras se ejecuta..." << "\n"; // Mensaje informativo
 	}
+	_config = ParallelProfile::get().lookup(_mode, board.get_board_size()); // Parámetros de reparto del perfil
+}
+
+namespace {
+
+// Lee el indicador de resuelto compartido entre hilos
+inline bool is_solved(const bool& solved)
+{
+	bool value;
+	#pragma omp atomic read
+	value = solved;
+	return value;
+}
+
+}
+
+// Resuelve con el kernel indicado en la configuración
+void SudokuSolver_ParallelBruteForce::solve()
+{
+	switch (_config.kernel)
+	{
+		case 2:  solve_kernel_2(); break;
+		case 3:  solve_kernel_3(); break;
+		default: solve_kernel_1(); break;
+	}
+}
+
+// Guarda la primera solución encontrada (varios hilos pueden llegar a la vez)
+void SudokuSolver_ParallelBruteForce::store_solution(const SudokuBoard& solution)
+{
+	#pragma omp critical(bruteforce_solution)
+	{
+		if (!_solved)
+		{
+			_solution = solution;
+			#pragma omp atomic write
+			_solved = true;
+		}
+	}
+}
+
+// Acumula las estadísticas de búsqueda (no hace nada si están desactivadas)
+void SudokuSolver_ParallelBruteForce::merge_stats(const SearchStats& stats)
+{
+	if (SearchStats::enabled)
+	{
+		#pragma omp critical(bruteforce_stats)
+		_stats.merge(stats);
+	}
 }
 
 // Método de inicialización (bootstrap) para llenar las celdas vacías
@@ -53,7 +103,7 @@ void SudokuSolver_ParallelBruteForce::bootstrap(SudokuBoardDeque& boardDeque, in
 	// Rellena las celdas vacías en la fila especificada
 	while (!checkIfRowFilled(boardDeque.front(), indexOfRows))
 	{
-		SudokuBoard board = boardDeque.front(); // Obtiene el primer tablero de la cola
+		SudokuBoard board = std::move(boardDeque.front()); // Toma el primer tablero de la cola (se descarta después)
 
 		int empty_cell_col_index = find_empty_from_row(board, indexOfRows); // Encuentra la celda vacía en la fila
 
@@ -79,12 +129,17 @@ void SudokuSolver_ParallelBruteForce::solve_kernel_1()
 	// Agrega el tablero inicial a la cola
 	_board_deque.push_back(_board);
 
-	// Asegura un nivel de inicialización (bootstrapping)
-	int num_bootstraps = omp_get_num_threads(); // Obtiene el número de hilos disponibles
-	#pragma omp parallel for schedule(static) default(none) shared(num_bootstraps) // Directiva para paralelismo
-	for (int i = 0; i < num_bootstraps; ++i)
+	int num_threads = (_config.num_threads > 0) ? _config.num_threads : omp_get_max_threads(); // Número de hilos a usar
+
+	// Expande la frontera (en anchura) hasta tener suficientes tableros para repartir entre los hilos.
+	// Se hace de forma secuencial: bootstrap modifica el deque y no puede llamarse desde varios hilos a la vez.
+	int frontier_size = (_config.frontier_size > 0) ? _config.frontier_size : 4 * num_threads;
 	{
-		bootstrap(); // Llama al método bootstrap en paralelo
+		TraceScope scope("frontier");
+		while (_board_deque.size() > 0 && _board_deque.size() < frontier_size && !checkIfAllFilled(_board_deque.front()))
+		{
+			bootstrap(); // Sustituye el primer tablero por sus hijos
+		}
 	}
 
 	int numberOfBoards = _board_deque.size(); // Obtiene el número de tableros en la cola
@@ -98,41 +153,55 @@ void SudokuSolver_ParallelBruteForce::solve_kernel_1()
 	// 	std::cout << "*****" << "\n";
 	// }
 
-	std::vector<SudokuSolver_SequentialBruteForce> solvers; // Vector de solucionadores secuenciales
-
-	#pragma omp parallel for schedule(static) default(none) shared(numberOfBoards, solvers) // Directiva para paralelismo
-    for (int indexOfBoard = 0; indexOfBoard < numberOfBoards; ++indexOfBoard)
+	#pragma omp parallel num_threads(num_threads) default(none) shared(numberOfBoards) // Directiva para paralelismo
 	{
-		solvers.push_back(SudokuSolver_SequentialBruteForce(_board_deque[indexOfBoard], false)); // Crea un solucionador secuencial para cada tablero
-		
-		// Nota: No se permite la instrucción break en OpenMP, todas las iteraciones deben procesarse.
-		// La solución es establecer un flag como verdadero cuando se cumple la condición, y dejar las iteraciones restantes sin trabajo.
-		if (_solved) { continue; } // Si ya se ha encontrado una solución, continúa con la siguiente iteración
+		#pragma omp for schedule(dynamic, 1) nowait
+		for (int indexOfBoard = 0; indexOfBoard < numberOfBoards; ++indexOfBoard)
+		{
+			// Nota: No se permite la instrucción break en OpenMP, todas las iteraciones deben procesarse.
+			// La solución es establecer un flag como verdadero cuando se cumple la condición, y dejar las iteraciones restantes sin trabajo.
+			if (is_solved(_solved) || (_budget != nullptr && _budget->exhausted())) // Si ya se ha encontrado una solución (o se agotó el presupuesto), continúa con la siguiente iteración
+			{
+				trace_instant("cancel", indexOfBoard);
+				continue;
+			}
+			TraceScope scope("subboard", indexOfBoard);
 
-		solvers[indexOfBoard].set_mode(MODES::PARALLEL_BRUTEFORCE); // Establece el modo del solucionador secuencial
+			// Cada iteración crea su propio solucionador secuencial (un vector compartido con push_back no es seguro entre hilos)
+			SudokuSolver_SequentialBruteForce solver(_board_deque[indexOfBoard], false);
+			solver.set_mode(MODES::PARALLEL_BRUTEFORCE); // Establece el modo del solucionador secuencial
+			solver.use_budget(_budget); // Los subtableros gastan el presupuesto común
 
-        solvers[indexOfBoard].solve(); // Resuelve el tablero
+			solver.solve(); // Resuelve el tablero
+			merge_stats(solver.get_stats()); // Acumula las estadísticas del subárbol
 
-		if (solvers[indexOfBoard].get_status() == true) // Si se ha encontrado una solución
-		{
-			_solved = true; // Marca como resuelto
-			_solution = solvers[indexOfBoard].get_solution(); // Almacena la solución
+			if (solver.get_status() == true) // Si se ha encontrado una solución
+			{
+				store_solution(solver.get_solution()); // Marca como resuelto y almacena la solución
+			}
 		}
+
+		// Tiempo que cada hilo espera a los demás (desequilibrio de carga entre subtableros)
+		TraceScope idle("idle");
+		#pragma omp barrier
 	}
 }
 
 // Método secundario para resolver el Sudoku utilizando paralelismo
 void SudokuSolver_ParallelBruteForce::solve_kernel_2()
 {
+	int num_threads = (_config.num_threads > 0) ? _config.num_threads : omp_get_max_threads(); // Número de hilos a usar
 	std::vector<SudokuBoardDeque> groupOfBoardDeques(_board.get_board_size(), SudokuBoardDeque(_board)); // Crea un grupo de colas de tableros
-	#pragma omp parallel default(none) shared(groupOfBoardDeques) // Directiva para paralelismo
+	#pragma omp parallel num_threads(num_threads) default(none) shared(groupOfBoardDeques) // Directiva para paralelismo
 	{	
 		int SIZE = groupOfBoardDeques.size(); // Tamaño del grupo de colas
 
 		#pragma omp for nowait schedule(static) // Directiva para paralelismo sin espera
 		for (int i = 0; i < SIZE; ++i)
 		{
+			TraceScope scope("frontier", i);
 			bootstrap(groupOfBoardDeques[i], i); // Inicializa cada cola con un índice específico
+			#pragma omp critical(bruteforce_deque) // El deque principal es compartido
 			_board_deque.boardDeque.insert(_board_deque.boardDeque.end(), // Inserta los tableros procesados en la cola principal
 										   groupOfBoardDeques[i].boardDeque.begin(),
 										   groupOfBoardDeques[i].boardDeque.end());
@@ -150,31 +219,56 @@ void SudokuSolver_ParallelBruteForce::solve_kernel_2()
 	// 	std::cout << "*****" << "\n";
 	// }
 
-	std::vector<SudokuSolver_SequentialBruteForce> solvers; // Vector de solucionadores secuenciales
+	#pragma omp parallel num_threads(num_threads) default(none) shared(numberOfBoards) // Directiva para paralelismo
+	{
+		#pragma omp for schedule(dynamic, 1) nowait
+		for (int indexOfBoard = 0; indexOfBoard < numberOfBoards; ++indexOfBoard)
+		{	
+			// Nota: No se permite la instrucción break en OpenMP, todas las iteraciones deben procesarse.
+			// La solución es establecer un flag como verdadero cuando se cumple la condición, y dejar las iteraciones restantes sin trabajo.
+			if (is_solved(_solved) || (_budget != nullptr && _budget->exhausted())) // Si ya se ha encontrado una solución (o se agotó el presupuesto), continúa con la siguiente iteración
+			{
+				trace_instant("cancel", indexOfBoard);
+				continue;
+			}
+			TraceScope scope("subboard", indexOfBoard);
 
-	#pragma omp parallel for schedule(static) default(none) shared(numberOfBoards, solvers) // Directiva para paralelismo
-    for (int indexOfBoard = 0; indexOfBoard < numberOfBoards; ++indexOfBoard)
-	{	
-		solvers.push_back(SudokuSolver_SequentialBruteForce(_board_deque[indexOfBoard], false)); // Crea un solucionador secuencial para cada tablero
+			SudokuSolver_SequentialBruteForce solver(_board_deque[indexOfBoard], false); // Crea un solucionador secuencial para cada tablero
+			solver.set_mode(MODES::PARALLEL_BRUTEFORCE); // Sin barra de progreso dentro de la región paralela
+			solver.use_budget(_budget); // Los subtableros gastan el presupuesto común
+			solver.solve(); // Resuelve el tablero
+			merge_stats(solver.get_stats()); // Acumula las estadísticas del subárbol
 
-		// Nota: No se permite la instrucción break en OpenMP, todas las iteraciones deben procesarse.
-		// La solución es establecer un flag como verdadero cuando se cumple la condición, y dejar las iteraciones restantes sin trabajo.
-		if (_solved) { continue; } // Si ya se ha encontrado una solución, continúa con la siguiente iteración
+			if (solver.get_status() == true) // Si se ha encontrado una solución
+			{
+				store_solution(solver.get_solution()); // Marca como resuelto y almacena la solución
+			}
+		}
 
-        solvers[indexOfBoard].solve(); // Resuelve el tablero
+		// Tiempo que cada hilo espera a los demás (desequilibrio de carga entre subtableros)
+		TraceScope idle("idle");
+		#pragma omp barrier
+	}
+}
 
-		if (solvers[indexOfBoard].get_status() == true) // Si se ha encontrado una solución
-		{
-			_solved = true; // Marca como resuelto
-			_solution = solvers[indexOfBoard].get_solution(); // Almacena la solución
-		}
+// Método terciario: un hilo recorre el árbol creando una tarea por rama hasta task_cutoff celdas rellenadas
+void SudokuSolver_ParallelBruteForce::solve_kernel_3()
+{
+	int num_threads = (_config.num_threads > 0) ? _config.num_threads : omp_get_max_threads(); // Número de hilos a usar
+	SudokuBoard board(_board); // Copia de trabajo del tablero
+
+	#pragma omp parallel num_threads(num_threads) default(none) shared(board) // Directiva para paralelismo
+	{
+		#pragma omp single // Un solo hilo crea las tareas; el resto las ejecuta
+		solve_bruteforce_par(board, 0, 0);
 	}
 }
 
 // Método para resolver el Sudoku de forma secuencial
-void SudokuSolver_ParallelBruteForce::solve_bruteforce_seq(SudokuBoard& board, int row, int col)
+void SudokuSolver_ParallelBruteForce::solve_bruteforce_seq(SudokuBoard& board, int row, int col, int depth, SearchStats& stats)
 {
-	if (_solved) { return; } // Si ya se ha encontrado una solución, retorna
+	if (is_solved(_solved)) { return; } // Si ya se ha encontrado una solución, retorna
+	if (out_of_budget()) { return; } // Límite de tiempo, nodos o memoria alcanzado
 	
 	int BOARD_SIZE = board.get_board_size(); // Obtiene el tamaño del tablero
 
@@ -182,8 +276,8 @@ void SudokuSolver_ParallelBruteForce::solve_bruteforce_seq(SudokuBoard& board, i
 
     if (abs_index >= board.get_num_total_cells()) // Si se han procesado todas las celdas
 	{
-		_solved = true; // Marca como resuelto
-		_solution = board; // Almacena la solución
+		stats.node(depth);
+		store_solution(board); // Marca como resuelto y almacena la solución
 		return;
     }
     
@@ -192,10 +286,20 @@ void SudokuSolver_ParallelBruteForce::solve_bruteforce_seq(SudokuBoard& board, i
 
 	if (!isEmpty(board, row, col)) // Si la celda no está vacía
 	{   
-		solve_bruteforce_seq(board, row_next, col_next); // Llama recursivamente a la siguiente celda
+		solve_bruteforce_seq(board, row_next, col_next, depth, stats); // Llama recursivamente a la siguiente celda
     }
 	else
 	{
+		stats.node(depth);
+		if constexpr (SearchStats::enabled) // Factor de ramificación: candidatos válidos de la celda
+		{
+			int candidates = 0;
+			for (int num = board.get_min_value(); num <= board.get_max_value(); ++num)
+			{
+				if (isValid(board, num, std::make_pair(row, col))) { ++candidates; }
+			}
+			stats.branch(depth, candidates);
+		}
 		// Rellena todas las posibles cifras
         for (int num = board.get_min_value(); num <= board.get_max_value(); ++num)
 		{
@@ -208,29 +312,32 @@ void SudokuSolver_ParallelBruteForce::solve_bruteforce_seq(SudokuBoard& board, i
 				if (isUnique(board, num, pos)) { num = BOARD_SIZE + 1; }   // Forzar a salir del bucle for
 
 				// Intenta la siguiente celda recursivamente
-                solve_bruteforce_seq(board, row_next, col_next);
+                solve_bruteforce_seq(board, row_next, col_next, depth + 1, stats);
 
 				board.set_board_data(row, col, board.get_empty_cell_value()); // Restablece la celda a su valor vacío
+				if (!is_solved(_solved)) { stats.backtrack(); }
             }
         }
     }
-
-	_recursionDepth++; // Incrementa la profundidad de recursión
 }
 
 // Método para resolver el Sudoku de forma paralela
-void SudokuSolver_ParallelBruteForce::solve_bruteforce_par(SudokuBoard& board, int row, int col)
+void SudokuSolver_ParallelBruteForce::solve_bruteforce_par(SudokuBoard& board, int row, int col, int depth /*=0*/)
 {
-	if (_solved) { return; } // Si ya se ha encontrado una solución, retorna
+	if (is_solved(_solved)) { return; } // Si ya se ha encontrado una solución, retorna
+	if (out_of_budget()) { return; } // Límite de tiempo, nodos o memoria alcanzado
 	
 	int BOARD_SIZE = board.get_board_size(); // Obtiene el tamaño del tablero
 
 	int abs_index = row * BOARD_SIZE + col; // Calcula el índice absoluto de la celda
 
+    SearchStats stats; // Estadísticas de esta tarea, se acumulan al terminar
+
     if (abs_index >= board.get_num_total_cells()) // Si se han procesado todas las celdas
 	{
-		_solved = true; // Marca como resuelto
-		_solution = board; // Almacena la solución
+		stats.node(depth);
+		merge_stats(stats);
+		store_solution(board); // Marca como resuelto y almacena la solución
 		return;
     }
     
@@ -239,10 +346,20 @@ void SudokuSolver_ParallelBruteForce::solve_bruteforce_par(SudokuBoard& board, i
 
 	if (!isEmpty(board, row, col)) // Si la celda no está vacía
 	{   
-		solve_bruteforce_par(board, row_next, col_next); // Llama recursivamente a la siguiente celda
+		solve_bruteforce_par(board, row_next, col_next, depth); // Llama recursivamente a la siguiente celda
     }
 	else
 	{
+		stats.node(depth);
+		if constexpr (SearchStats::enabled) // Factor de ramificación: candidatos válidos de la celda
+		{
+			int candidates = 0;
+			for (int num = board.get_min_value(); num <= board.get_max_value(); ++num)
+			{
+				if (isValid(board, num, std::make_pair(row, col))) { ++candidates; }
+			}
+			stats.branch(depth, candidates);
+		}
 		// Rellena todas las posibles cifras
         for (int num = board.get_min_value(); num <= board.get_max_value(); ++num)
 		{
@@ -254,14 +371,18 @@ void SudokuSolver_ParallelBruteForce::solve_bruteforce_par(SudokuBoard& board, i
 				// Alternativamente, podemos usar la cláusula final en la directiva #pragma omp task
 				// Si no establecemos un umbral, la carga de trabajo de una sola tarea es demasiado pequeña
 				// y el costo de crear tareas se vuelve significativo en comparación con la carga de trabajo.
-				if (_recursionDepth > BOARD_SIZE)
+				// El umbral es el número de celdas vacías ya rellenadas en este camino (task_cutoff del perfil).
+				if (depth >= _config.task_cutoff)
 				{
 					board.set_board_data(row, col, num); // Establece el número en la celda
 
 					if (isUnique(board, num, pos)) { num = BOARD_SIZE + 1; }   // Forzar a salir del bucle for
 
 					// Intenta la siguiente celda recursivamente
-					solve_bruteforce_seq(board, row_next, col_next);
+					solve_bruteforce_seq(board, row_next, col_next, depth + 1, stats);
+
+					board.set_board_data(row, col, board.get_empty_cell_value()); // Restablece la celda a su valor vacío
+					if (!is_solved(_solved)) { stats.backtrack(); }
 				}
 				else
 				{
@@ -272,14 +393,20 @@ void SudokuSolver_ParallelBruteForce::solve_bruteforce_par(SudokuBoard& board, i
 					if (isUnique(board, num, pos)) { num = BOARD_SIZE + 1; }   // Forzar a salir del bucle for
 
 					// Intenta la siguiente celda recursivamente
-					#pragma omp task default(none) firstprivate(local_board, row_next, col_next) // Crea una tarea paralela
-					solve_bruteforce_par(local_board, row_next, col_next); // Llama a la función en paralelo
+					int spawner = omp_get_thread_num(); // Hilo que crea la tarea (para detectar robos en la traza)
+					trace_instant("spawn", depth + 1);
+					#pragma omp task default(none) firstprivate(local_board, row_next, col_next, depth, spawner) // Crea una tarea paralela
+					{
+						if (omp_get_thread_num() != spawner) { trace_instant("steal", depth + 1); }
+						TraceScope scope("task", depth + 1);
+						solve_bruteforce_par(local_board, row_next, col_next, depth + 1); // Llama a la función en paralelo
+					}
 
 					// board.set_board_data(row, col, board.get_empty_cell_value()); // No es necesario ya que no modificamos nada en el tablero original
 				}
             }
         }
     }
-	
-	_recursionDepth++; // Incrementa la profundidad de recursión
+
+	merge_stats(stats);
 }
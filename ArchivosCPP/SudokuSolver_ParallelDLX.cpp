@@ -1,6 +1,8 @@
 #include "SudokuSolver_ParallelDLX.hpp"
-#include "termcolor.hpp"                 
-#include <omp.h>                         
+#include "SudokuSolver_SequentialDLX.hpp"
+#include "ParallelTrace.hpp"
+#include "termcolor.hpp"
+#include <omp.h>
 
 // Constructor del solucionador de Sudoku paralelo usando el algoritmo de "dancing links"
 SudokuSolver_ParallelDLX::SudokuSolver_ParallelDLX(SudokuBoard& board, bool print_message /*=true*/)
@@ -9,102 +11,182 @@ SudokuSolver_ParallelDLX::SudokuSolver_ParallelDLX(SudokuBoard& board, bool prin
     if (print_message){
         std::cout << "\n Iniciando el algoritmo DLX paralelo porfavor espere mientras se ejecuta...\n";
     }
-    board.createCoverMatrix(_coverMatrix);           // Crear la matriz de cobertura
-    board.convertToCoverMatrix(_coverMatrix);        // Convertir el tablero a matriz de cobertura
-    _numberOfRows = _coverMatrix.size();             // Obtener el número de filas
-    _numberOfColumns = _coverMatrix[0].size();       // Obtener el número de columnas
-    _header = createDLXList(_coverMatrix);           // Crear la lista de "dancing links"
+    // Copiar la plantilla del tamaño del tablero y cubrir las filas de las pistas
+    _dlx.reset(DLXTemplate::get(board.get_board_size()));
+    _consistent = _dlx.coverGivens(board);
+    _config = ParallelProfile::get().lookup(_mode, board.get_board_size());
 }
 
-// Función para crear la lista de "dancing links" desde la matriz de cobertura
-ColumnNode* SudokuSolver_ParallelDLX::createDLXList(CoverMatrix& coverMatrix){
-    ColumnNode* headerNode = new ColumnNode("header"); // Nodo cabecera creado en el heap para mantener vida útil
-    std::vector<ColumnNode*> columnNodes;
-    for (int i = 0; i < _numberOfColumns; ++i){
-        ColumnNode* n = new ColumnNode(std::to_string(i));
-        columnNodes.push_back(n);
-        headerNode = (ColumnNode*) headerNode->linkRight(n); // Enlazar nodos columna a la derecha
+// Convertir la solución de filas de cobertura a un tablero de Sudoku
+SudokuBoard SudokuSolver_ParallelDLX::convertToSudokuGrid(const DLXInstance& dlx, const std::vector<int>& answer){
+    SudokuBoard tmpBoard = SudokuBoard(_board);   // Las pistas ya están en el tablero original
+    for (int n : answer){
+        dlx.applyToBoard(n, tmpBoard);
     }
-    headerNode = headerNode->right->column;
-    for (int i = 0; i < _numberOfRows; ++i){
-        DancingNode* prev = NULL;
-        for (int j = 0; j < _numberOfColumns; ++j){
-            if (coverMatrix[i][j] == 1){
-                ColumnNode* col = columnNodes[j];
-                DancingNode* newNode = new DancingNode(col); // Crear nodo de "dancing links"
-                if (prev == NULL) { prev = newNode; }
-                col->top->linkDown(newNode); // Enlazar nodos hacia abajo
-                prev = prev->linkRight(newNode); // Enlazar nodos a la derecha
-                col->size++;
-            }
-        }
-    }
-    headerNode->size = _numberOfColumns; // Asignar tamaño de columnas al nodo cabecera
-    return headerNode;
+    return tmpBoard;
 }
 
-// Convertir la solución de la lista de "dancing nodes" a un tablero de Sudoku
-SudokuBoard SudokuSolver_ParallelDLX::convertToSudokuGrid(std::vector<DancingNode*> answer){
-    SudokuBoard tmpBoard = SudokuBoard(_board);
-    for (DancingNode* n : answer){
-        DancingNode* rcNode = n;
-        int min = std::stoi(rcNode->column->name);
-        for (DancingNode* tmp = n->right; tmp != n; tmp = tmp->right){
-            int val = std::stoi(tmp->column->name);
-            if (val < min){
-                min = val;
-                rcNode = tmp;
-            }
-        }
-        int ans1 = std::stoi(rcNode->column->name);
-        int ans2 = std::stoi(rcNode->right->column->name);
-        int r = ans1 / _board.get_board_size();
-        int c = ans1 % _board.get_board_size();
-        int num = (ans2 % _board.get_board_size()) + 1;
-        tmpBoard.set_board_data(r, c, num);
+// Guarda en la frontera los caminos de longitud depth (o más cortos si llegan antes a una solución)
+void SudokuSolver_ParallelDLX::expand_frontier(DLXInstance& dlx, std::vector<int>& prefix, int depth, std::vector<std::vector<int>>& frontier){
+    if (depth == 0 || dlx.empty()){
+        frontier.push_back(prefix);
+        return;
     }
-    return tmpBoard;
+    int c = dlx.selectColumn();
+    dlx.cover(c);
+    for (int r = dlx.down(c); r != c; r = dlx.down(r)){
+        prefix.push_back(r);
+        dlx.coverRow(r);
+        expand_frontier(dlx, prefix, depth - 1, frontier);
+        dlx.uncoverRow(r);
+        prefix.pop_back();
+    }
+    dlx.uncover(c);
 }
 
-// Núcleo del algoritmo de "dancing links" para resolver el Sudoku
-void SudokuSolver_ParallelDLX::solve_kernel(int k){
-    if (_header->right == _header){
+// Reparte los subárboles de la frontera entre los hilos; cada hilo trabaja sobre su propia copia (memcpy)
+// y rehace el camino de cada subárbol cubriendo sus filas
+void SudokuSolver_ParallelDLX::solve(){
+    if (!_consistent) { return; }
+    if (_dlx.empty()){
         _solved = true;
-        _solution = convertToSudokuGrid(_answer); // Convertir y almacenar solución si se encuentra
+        _solution = _board;   // Todas las celdas son pistas
         return;
-    } else {
-        ColumnNode* c = (ColumnNode*) _header->right;
-        c = selectColumnNodeHeuristic(c, k);
-        c->cover(); // Cubrir la columna seleccionada
-        for (DancingNode* r = c->bottom; r != c; r = r->bottom){
-            _answer.push_back(r);
-            for (DancingNode* j = r->right; j != r; j = j->right){
-                j->column->cover(); // Cubrir nodos en la fila
+    }
+
+    std::vector<std::vector<int>> frontier;
+    std::vector<int> prefix;
+    {
+        TraceScope scope("frontier");
+        DLXInstance root(_dlx);
+        expand_frontier(root, prefix, (_config.split_depth > 0) ? _config.split_depth : 1, frontier);
+    }
+    int numberOfSubtrees = frontier.size();
+    int num_threads = (_config.num_threads > 0) ? _config.num_threads : omp_get_max_threads();
+
+    #pragma omp parallel num_threads(num_threads) default(none) shared(frontier, numberOfSubtrees)
+    {
+        DLXInstance dlx(_dlx);        // Copia privada del hilo
+        std::vector<int> answer;
+        std::vector<int> columns;     // Pila de columnas del hilo
+        SearchStats stats;            // Estadísticas del hilo, se acumulan al final
+
+        #pragma omp for schedule(dynamic, 1) nowait
+        for (int i = 0; i < numberOfSubtrees; ++i){
+            // Nota: No se permite la instrucción break en OpenMP; las iteraciones restantes quedan sin trabajo
+            bool solved;
+            #pragma omp atomic read
+            solved = _solved;
+            if (solved || (_budget != nullptr && _budget->exhausted())){
+                trace_instant("cancel", i);
+                continue;
+            }
+            TraceScope scope("subboard", i);
+
+            const std::vector<int>& path = frontier[i];
+            for (int r : path){
+                dlx.cover(dlx.column(r));
+                dlx.coverRow(r);
             }
-            solve_kernel(k + 1);
-            if (_solved) { return; }
-            r = _answer[_answer.size() - 1];
-            _answer.pop_back();
-            c = r->column;
-            for (DancingNode* j = r->left; j != r; j = j->left){
-                j->column->uncover(); // Descubrir nodos en la fila
+            answer = path;
+            solve_kernel(dlx, answer, columns, stats);
+            for (int j = path.size() - 1; j >= 0; --j){   // Deshacer en orden inverso
+                dlx.uncoverRow(path[j]);
+                dlx.uncover(dlx.column(path[j]));
             }
         }
-        c->uncover(); // Descubrir la columna
+
+        if (SearchStats::enabled){
+            #pragma omp critical(dlx_stats)
+            _stats.merge(stats);
+        }
+
+        // Tiempo que cada hilo espera a los demás (desequilibrio de carga entre subárboles)
+        TraceScope idle("idle");
+        #pragma omp barrier
     }
 }
 
-// Selección heurística de la columna a cubrir
-ColumnNode* SudokuSolver_ParallelDLX::selectColumnNodeHeuristic(ColumnNode* c, int k){
-    if (k == 0){
-        int id = omp_get_thread_num(); // Obtener el ID del hilo actual
-        for (int i = 0; i < id; i++){
-            c = (ColumnNode*) c->right;
+// Núcleo del algoritmo de "dancing links" para resolver el Sudoku: cada vuelta del bucle es un nodo del árbol.
+// Al volver, la lista queda como al entrar (solo con el camino del subárbol cubierto)
+void SudokuSolver_ParallelDLX::solve_kernel(DLXInstance& dlx, std::vector<int>& answer, std::vector<int>& columns, SearchStats& stats){
+    columns.clear();
+    while (true){
+        int k = answer.size();
+        bool solved;
+        #pragma omp atomic read
+        solved = _solved;
+        if (solved || out_of_budget()){   // Otro hilo ya encontró la solución o se alcanzó un límite
+            SudokuSolver_SequentialDLX::unwind(dlx, answer, columns);
+            return;
+        }
+        stats.node(k);
+
+        if (dlx.empty()){
+            #pragma omp critical(dlx_solution)
+            {
+                if (!_solved){
+                    _solution = convertToSudokuGrid(dlx, answer); // Convertir y almacenar solución si se encuentra
+                    #pragma omp atomic write
+                    _solved = true;
+                }
+            }
+            SudokuSolver_SequentialDLX::unwind(dlx, answer, columns);
+            return;
+        }
+
+        int c = dlx.selectColumn();   // Elegir la restricción con menos opciones para satisfacer
+        stats.branch(k, dlx.columnSize(c));
+        dlx.cover(c); // Cubrir la columna seleccionada
+        int r = dlx.down(c);
+        if (r != c){
+            columns.push_back(c);
+            answer.push_back(r);
+            dlx.coverRow(r); // Cubrir nodos en la fila
+            continue;
         }
-    } else {
-        for (ColumnNode* temp = (ColumnNode*) c->right; temp != _header; temp = (ColumnNode*) temp->right){
-            if (temp->size < c->size) c = temp; // Elegir columna con menos opciones disponibles
+        dlx.uncover(c); // Restricción imposible de satisfacer: descubrir y retroceder
+        if (!SudokuSolver_SequentialDLX::backtrack(dlx, answer, columns, &stats)) { return; }
+    }
+}
+
+// Cuenta las soluciones repartiendo las filas de la primera columna entre los hilos
+int SudokuSolver_ParallelDLX::count_solutions(int limit /*=2*/, int num_threads /*=0*/){
+    if (!_consistent || limit <= 0) { return 0; }
+    if (_dlx.empty()) { return 1; }
+
+    int c = _dlx.selectColumn();
+    std::vector<int> rows;
+    for (int r = _dlx.down(c); r != c; r = _dlx.down(r)){
+        rows.push_back(r);
+    }
+    int numberOfRows = rows.size();
+    int found = 0;     // Soluciones encontradas hasta ahora por todos los hilos
+    int count = 0;
+    if (num_threads <= 0) { num_threads = omp_get_max_threads(); }
+
+    #pragma omp parallel num_threads(num_threads) default(none) shared(rows, numberOfRows, c, limit, found) reduction(+:count)
+    {
+        DLXInstance dlx(_dlx);        // Copia privada del hilo
+        dlx.cover(c);
+
+        #pragma omp for schedule(dynamic, 1)
+        for (int i = 0; i < numberOfRows; ++i){
+            int alreadyFound;
+            #pragma omp atomic read
+            alreadyFound = found;
+            if (alreadyFound >= limit) { continue; }   // Ya se alcanzó el límite: el resto de subárboles sobra
+
+            int r = rows[i];
+            int local = 0;
+            dlx.coverRow(r);
+            SudokuSolver_SequentialDLX::count_kernel(dlx, limit - alreadyFound, local);
+            dlx.uncoverRow(r);
+
+            #pragma omp atomic
+            found += local;
+            count += local;
         }
     }
-    return c;
+    return (count < limit) ? count : limit;
 }
@@ -5,40 +5,67 @@
 SudokuSolver_SequentialBacktracking::SudokuSolver_SequentialBacktracking(SudokuBoard& board, bool print_message /*=true*/)
 : SudokuSolver(board){
     _mode = MODES::SEQUENTIAL_BACKTRACKING;
+    _show_progress = print_message;   // Sin mensajes tampoco se arranca el hilo de la barra de progreso
     if (print_message){
         std::cout << "\n Resolviendo el sudoku usando el algoritmo backtraking secuencial, porfavor espere mientras se ejecuta...\n";
     }
+    _stack.reserve(board.get_init_num_empty_cells() + 1);
 }
 
-// Función para resolver el Sudoku usando backtracking
+// Función para resolver el Sudoku usando backtracking. Cada vuelta del bucle entra en un nodo nuevo (descend)
+// o prueba el siguiente número del nivel más profundo de la pila
 bool SudokuSolver_SequentialBacktracking::solve_kernel(){
     if (_solved) { return _solved; }  // Si el Sudoku ya está resuelto, retornar el estado resuelto
-    if (_mode == MODES::SEQUENTIAL_BACKTRACKING) {
-        show_progress_bar(_board, _recursionDepth);  // Mostrar barra de progreso
-    }
-    if (checkIfAllFilled(_board)) {  // Caso base: si todas las celdas están llenas
-        _solved = true;
-        _solution = _board;  // Guardar solución
-        return _solved;
-    }
-    Position empty_cell_pos = find_empty(_board);  // Encontrar celda vacía
-    int row = empty_cell_pos.first;
-    int col = empty_cell_pos.second;
-    for (int num = _board.get_min_value(); num <= _board.get_max_value(); ++num){
-        if (isValid(_board, num, empty_cell_pos)){  // Verificar si el número es válido en la posición
-            _board.set_board_data(row, col, num);  // Asignar número a la celda
-            if (isUnique(_board, num, empty_cell_pos)) { 
-                num = _board.get_board_size() + 1;  // Forzar salida del bucle si el número es único
+    _stack.clear();
+    bool descend = true;
+    while (true){
+        if (descend){
+            int depth = _stack.size();  // Celdas rellenadas por la búsqueda
+            if (out_of_budget()){  // Límite de tiempo, nodos o memoria alcanzado: deshacer lo colocado
+                for (const ChoicePoint& choice : _stack){
+                    _board.set_board_data(choice.pos.first, choice.pos.second, _board.get_empty_cell_value());
+                }
+                return false;
             }
-            if (solve_kernel()) {  // Intentar resolver la siguiente celda recursivamente
+            _stats.node(depth);
+            publish_progress(depth);  // Progreso para la barra (la dibuja otro hilo)
+            if (checkIfAllFilled(_board)) {  // Caso base: si todas las celdas están llenas
                 _solved = true;
+                _solution = _board;  // Guardar solución
                 return _solved;
-            } else {
-                _board.set_board_data(row, col, _board.get_empty_cell_value());  // Retroceder si no se resuelve
             }
+            Position empty_cell_pos = find_empty(_board);  // Encontrar celda vacía
+            if constexpr (SearchStats::enabled) {   // Factor de ramificación: candidatos válidos de la celda
+                int candidates = 0;
+                for (int num = _board.get_min_value(); num <= _board.get_max_value(); ++num){
+                    if (isValid(_board, num, empty_cell_pos)) { ++candidates; }
+                }
+                _stats.branch(depth, candidates);
+            }
+            _stack.push_back({ empty_cell_pos, _board.get_min_value(), false });
+        }
+
+        ChoicePoint& top = _stack.back();
+        descend = false;
+        while (!top.last && top.num <= _board.get_max_value()){
+            int num = top.num++;
+            if (isValid(_board, num, top.pos)){  // Verificar si el número es válido en la posición
+                _board.set_board_data(top.pos.first, top.pos.second, num);  // Asignar número a la celda
+                top.last = isUnique(_board, num, top.pos);  // Si el número es único no se prueban más
+                descend = true;
+                break;
+            }
+        }
+        if (descend) { continue; }  // Intentar resolver la siguiente celda
+
+        // Ningún valor resuelve esta celda: subir un nivel y retroceder la celda del padre
+        _stack.pop_back();
+        if (_stack.empty()){
+            _solved = false;  // Si ninguno de los valores resuelve el Sudoku, marcar como no resuelto
+            return _solved;
         }
+        const Position& pos = _stack.back().pos;
+        _board.set_board_data(pos.first, pos.second, _board.get_empty_cell_value());  // Retroceder si no se resuelve
+        _stats.backtrack();
     }
-    _recursionDepth++;  // Incrementar profundidad de recursión
-    _solved = false;  // Si ninguno de los valores resuelve el Sudoku, marcar como no resuelto
-    return _solved;
 }
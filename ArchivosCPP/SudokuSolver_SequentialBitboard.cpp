@@ -0,0 +1,30 @@
+#include "SudokuSolver_SequentialBitboard.hpp"  // Incluir encabezado específico para el solucionador con máscaras de bits
+#include <iostream>                             // Incluir biblioteca de entrada/salida estándar
+
+// Constructor del solucionador de Sudoku secuencial usando backtracking con máscaras de bits
+SudokuSolver_SequentialBitboard::SudokuSolver_SequentialBitboard(SudokuBoard& board, bool print_message /*=true*/)
+: SudokuSolver(board){
+    _mode = MODES::SEQUENTIAL_BITBOARD;
+    if (print_message){
+        std::cout << "\n Resolviendo el sudoku usando backtracking con mascaras de bits, porfavor espere mientras se ejecuta...\n";
+    }
+}
+
+// Resuelve el Sudoku sobre un tablero de bits construido a partir de las pistas en cada llamada, para poder
+// volver a resolver o contar después. El tamaño se despacha una sola vez aquí: dentro del kernel ya es una constante
+void SudokuSolver_SequentialBitboard::solve(){
+    with_bitboard(_board, [this](auto& bitboard){
+        bitboard.set_budget(_budget);
+        if (bitboard.solve()){
+            _solution = _board;
+            bitboard.write_to(_solution);  // Guardar solución
+            _solved = true;
+        }
+        _stats.merge(bitboard.get_stats());
+    });
+}
+
+// Cuenta las soluciones hasta limit
+int SudokuSolver_SequentialBitboard::count_solutions(int limit /*=2*/){
+    return with_bitboard(_board, [limit](auto& bitboard){ return bitboard.count_solutions(limit); });
+}
@@ -5,42 +5,74 @@
 SudokuSolver_SequentialBruteForce::SudokuSolver_SequentialBruteForce(SudokuBoard& board, bool print_message /*=true*/)
 : SudokuSolver(board){
     _mode = MODES::SEQUENTIAL_BRUTEFORCE;
+    _show_progress = print_message;   // Sin mensajes tampoco se arranca el hilo de la barra de progreso
     if (print_message){
         std::cout << "\n Resolviendo sudoku usando el algoritmo secuencial fuerza bruta, porfavor espere mientras se ejecuta...\n";
     }
+    _stack.reserve(board.get_init_num_empty_cells() + 1);
 }
 
-// Función para resolver el Sudoku usando el algoritmo de fuerza bruta
-void SudokuSolver_SequentialBruteForce::solve_kernel(int row, int col){
+// Función para resolver el Sudoku usando el algoritmo de fuerza bruta. Cada vuelta del bucle avanza desde
+// index hasta la siguiente celda vacía (descend) o prueba el siguiente número del nivel más profundo de la pila
+void SudokuSolver_SequentialBruteForce::solve_kernel(){
     if (_solved) { return; }  // Si el Sudoku ya está resuelto, retornar
-    if (_mode == MODES::SEQUENTIAL_BRUTEFORCE) { 
-        show_progress_bar(_board, _recursionDepth);  // Mostrar barra de progreso
-    }
     int BOARD_SIZE = _board.get_board_size();
-    int abs_index = row * BOARD_SIZE + col;  // Calcular el índice absoluto
-    if (abs_index >= _board.get_num_total_cells()){  // Caso base: si se ha llenado todo el tablero
-        _solved = true;
-        _solution = _board;  // Guardar solución
-        return;
-    }
-    int row_next = (abs_index + 1) / BOARD_SIZE;  // Calcular la siguiente fila
-    int col_next = (abs_index + 1) % BOARD_SIZE;  // Calcular la siguiente columna
-    if (!isEmpty(_board, row, col)){  // Si la celda no está vacía, proceder a la siguiente celda
-        solve_kernel(row_next, col_next);
-    } else {
-        // Rellenar con todos los números posibles
-        for (int num = _board.get_min_value(); num <= _board.get_max_value(); ++num){
-            Position pos = std::make_pair(row, col);
-            if (isValid(_board, num, pos)){  // Verificar si el número es válido en la posición
-                _board.set_board_data(row, col, num);
-                if (isUnique(_board, num, pos)) { 
-                    num = BOARD_SIZE + 1;  // Forzar salida del bucle si el número es único
+    _stack.clear();
+    int index = 0;  // Siguiente celda a visitar al descender
+    bool descend = true;
+    while (true){
+        if (descend){
+            int depth = _stack.size();  // Celdas rellenadas por la búsqueda
+            // Saltar las celdas con pista (cada una cuenta como un paso de la búsqueda)
+            while (true){
+                if (out_of_budget()){  // Límite de tiempo, nodos o memoria alcanzado: deshacer lo colocado
+                    for (const ChoicePoint& choice : _stack){
+                        _board.set_board_data(choice.index / BOARD_SIZE, choice.index % BOARD_SIZE, _board.get_empty_cell_value());
+                    }
+                    return;
+                }
+                publish_progress(depth);  // Progreso para la barra (la dibuja otro hilo)
+                if (index >= _board.get_num_total_cells() || isEmpty(_board, index / BOARD_SIZE, index % BOARD_SIZE)) { break; }
+                ++index;
+            }
+            _stats.node(depth);
+            if (index >= _board.get_num_total_cells()){  // Caso base: si se ha llenado todo el tablero
+                _solved = true;
+                _solution = _board;  // Guardar solución
+                return;
+            }
+            if constexpr (SearchStats::enabled) {   // Factor de ramificación: candidatos válidos de la celda
+                int candidates = 0;
+                Position pos = std::make_pair(index / BOARD_SIZE, index % BOARD_SIZE);
+                for (int num = _board.get_min_value(); num <= _board.get_max_value(); ++num){
+                    if (isValid(_board, num, pos)) { ++candidates; }
                 }
-                // Intentar resolver la siguiente celda recursivamente
-                solve_kernel(row_next, col_next);
-                _board.set_board_data(row, col, _board.get_empty_cell_value());  // Retroceder si no se resuelve
+                _stats.branch(depth, candidates);
             }
+            _stack.push_back({ index, _board.get_min_value(), false });
         }
+
+        // Rellenar con el siguiente número posible
+        ChoicePoint& top = _stack.back();
+        Position pos = std::make_pair(top.index / BOARD_SIZE, top.index % BOARD_SIZE);
+        descend = false;
+        while (!top.last && top.num <= _board.get_max_value()){
+            int num = top.num++;
+            if (isValid(_board, num, pos)){  // Verificar si el número es válido en la posición
+                _board.set_board_data(pos.first, pos.second, num);
+                top.last = isUnique(_board, num, pos);  // Si el número es único no se prueban más
+                index = top.index + 1;  // Intentar resolver la siguiente celda
+                descend = true;
+                break;
+            }
+        }
+        if (descend) { continue; }
+
+        // Ningún valor resuelve esta celda: subir un nivel y retroceder la celda del padre
+        _stack.pop_back();
+        if (_stack.empty()) { return; }
+        int parent = _stack.back().index;
+        _board.set_board_data(parent / BOARD_SIZE, parent % BOARD_SIZE, _board.get_empty_cell_value());  // Retroceder si no se resuelve
+        _stats.backtrack();
     }
-    _recursionDepth++;  // Incrementar profundidad de recursión
 }
@@ -8,103 +8,121 @@ SudokuSolver_SequentialDLX::SudokuSolver_SequentialDLX(SudokuBoard& board, bool
     if (print_message){
         std::cout << "\n Resolviendo usando secuencial DLX algoritmo porfavor espere mientras se ejecuta...\n";
     }
-    board.createCoverMatrix(_coverMatrix);           // Crear la matriz de cobertura
-    board.convertToCoverMatrix(_coverMatrix);        // Convertir el tablero a matriz de cobertura
-    _numberOfRows = _coverMatrix.size();             // Obtener el número de filas
-    _numberOfColumns = _coverMatrix[0].size();       // Obtener el número de columnas
-    _header = createDLXList(_coverMatrix);           // Crear la lista de "dancing links"
+    // En vez de reconstruir la matriz de cobertura y todos los nodos, copiamos la plantilla del tamaño
+    // del tablero y cubrimos las filas de las pistas
+    _dlx.reset(DLXTemplate::get(board.get_board_size()));
+    _consistent = _dlx.coverGivens(board);
+    _answer.reserve(board.get_init_num_empty_cells());
+    _columns.reserve(board.get_init_num_empty_cells());
 }
 
-// Función para crear la lista de "dancing links" desde la matriz de cobertura
-ColumnNode* SudokuSolver_SequentialDLX::createDLXList(CoverMatrix& coverMatrix){
-    // Si declaramos headerNode como una variable local (en la "pila"), se limpiará de la memoria cuando finalice la llamada a la función
-    // ---> Para mantener su vida útil, creamos headerNode en el "montón" para que exista todo el tiempo
-    //      a menos que liberemos explícitamente la memoria asociada
-    ColumnNode* headerNode = new ColumnNode("header"); // Nodo cabecera creado en el heap para mantener vida útil
-    std::vector<ColumnNode*> columnNodes;
-    for (int i = 0; i < _numberOfColumns; ++i){
-        ColumnNode* n = new ColumnNode(std::to_string(i));
-        columnNodes.push_back(n);
-        headerNode = (ColumnNode*) headerNode->linkRight(n); // Enlazar nodos columna a la derecha
+// Convertir la solución de filas de cobertura a un tablero de Sudoku
+SudokuBoard SudokuSolver_SequentialDLX::convertToSudokuGrid(const std::vector<int>& answer){
+    SudokuBoard tmpBoard = SudokuBoard(_board);   // Las pistas ya están en el tablero original
+    for (int n : answer){
+        _dlx.applyToBoard(n, tmpBoard);
     }
-    headerNode = headerNode->right->column;
-    for (int i = 0; i < _numberOfRows; ++i){
-        DancingNode* prev = NULL;
-        for (int j = 0; j < _numberOfColumns; ++j){
-            if (coverMatrix[i][j] == 1){
-                ColumnNode* col = columnNodes[j];
-                DancingNode* newNode = new DancingNode(col); // Crear nodo de "dancing links"
-                if (prev == NULL) { prev = newNode; }
-                col->top->linkDown(newNode); // Enlazar nodos hacia abajo
-                prev = prev->linkRight(newNode); // Enlazar nodos a la derecha
-                col->size++;
-            }
+    return tmpBoard;
+}
+
+// Deshace la fila del nivel más profundo y cubre la siguiente de su columna; si la columna se agota,
+// la descubre y sube un nivel. Devuelve false cuando se ha recorrido todo el árbol
+bool SudokuSolver_SequentialDLX::backtrack(DLXInstance& dlx, std::vector<int>& rows, std::vector<int>& columns, SearchStats* stats){
+    while (!columns.empty()){
+        int c = columns.back();
+        int r = rows.back();
+        dlx.uncoverRow(r); // Descubrir nodos en la fila
+        if (stats != nullptr) { stats->backtrack(); }
+
+        r = dlx.down(r);
+        if (r != c){
+            rows.back() = r;
+            dlx.coverRow(r); // Cubrir nodos en la siguiente fila
+            return true;
         }
+
+        dlx.uncover(c); // Descubrir la columna
+        columns.pop_back();
+        rows.pop_back();
     }
-    headerNode->size = _numberOfColumns; // Asignar tamaño de columnas al nodo cabecera
-    return headerNode;
+    return false;
 }
 
-// Convertir la solución de la lista de "dancing nodes" a un tablero de Sudoku
-SudokuBoard SudokuSolver_SequentialDLX::convertToSudokuGrid(std::vector<DancingNode*> answer){
-    SudokuBoard tmpBoard = SudokuBoard(_board);
-    for (DancingNode* n : answer){
-        DancingNode* rcNode = n;
-        int min = std::stoi(rcNode->column->name);
-        for (DancingNode* tmp = n->right; tmp != n; tmp = tmp->right){
-            int val = std::stoi(tmp->column->name);
-            if (val < min){
-                min = val;
-                rcNode = tmp;
-            }
-        }
-        int ans1 = std::stoi(rcNode->column->name);
-        int ans2 = std::stoi(rcNode->right->column->name);
-        int r = ans1 / _board.get_board_size();
-        int c = ans1 % _board.get_board_size();
-        int num = (ans2 % _board.get_board_size()) + 1;
-        tmpBoard.set_board_data(r, c, num);
+// Descubre toda la pila para dejar la lista como antes de la búsqueda
+void SudokuSolver_SequentialDLX::unwind(DLXInstance& dlx, std::vector<int>& rows, std::vector<int>& columns){
+    while (!columns.empty()){
+        dlx.uncoverRow(rows.back());
+        dlx.uncover(columns.back());
+        rows.pop_back();
+        columns.pop_back();
     }
-    return tmpBoard;
 }
 
-// Núcleo del algoritmo de "dancing links" para resolver el Sudoku
-void SudokuSolver_SequentialDLX::solve_kernel(int k){
-    if (_header->right == _header){
-        _solved = true;
-        _solution = convertToSudokuGrid(_answer); // Convertir y almacenar solución si se encuentra
-        return;
-    } else {
-        ColumnNode* c = (ColumnNode*) _header->right;
-        c = selectColumnNodeHeuristic(c, k);
-        c->cover(); // Cubrir la columna seleccionada
-        for (DancingNode* r = c->bottom; r != c; r = r->bottom){
+// Núcleo del algoritmo de "dancing links" para resolver el Sudoku: cada vuelta del bucle es un nodo del árbol
+void SudokuSolver_SequentialDLX::solve_kernel(){
+    _answer.clear();
+    _columns.clear();
+    while (true){
+        int k = _answer.size();
+        if (out_of_budget()){   // Límite alcanzado: se descubre toda la pila para dejar la lista consistente
+            unwind(_dlx, _answer, _columns);
+            return;
+        }
+        _stats.node(k);
+        if (_dlx.empty()){
+            _solved = true;
+            _solution = convertToSudokuGrid(_answer); // Convertir y almacenar solución si se encuentra
+            unwind(_dlx, _answer, _columns);           // Dejar la lista como antes para volver a resolver o contar
+            return;
+        }
+
+        int c = _dlx.selectColumn();   // Elegir la restricción con menos opciones para satisfacer
+        _stats.branch(k, _dlx.columnSize(c));
+        _dlx.cover(c); // Cubrir la columna seleccionada
+        int r = _dlx.down(c);
+        if (r != c){
+            _columns.push_back(c);
             _answer.push_back(r);
-            for (DancingNode* j = r->right; j != r; j = j->right){
-                j->column->cover(); // Cubrir nodos en la fila
-            }
-            solve_kernel(k + 1);
-            if (_solved) { return; }
-            r = _answer[_answer.size() - 1];
-            _answer.pop_back();
-            c = r->column;
-            for (DancingNode* j = r->left; j != r; j = j->left){
-                j->column->uncover(); // Descubrir nodos en la fila
-            }
+            _dlx.coverRow(r); // Cubrir nodos en la fila
+            continue;
         }
-        c->uncover(); // Descubrir la columna
+        _dlx.uncover(c); // Restricción imposible de satisfacer: descubrir y retroceder
+        if (!backtrack(_dlx, _answer, _columns, &_stats)) { return; }
     }
 }
 
-// Selección heurística de la columna a cubrir
-ColumnNode* SudokuSolver_SequentialDLX::selectColumnNodeHeuristic(ColumnNode* c, int k){
-    if (k == 0){
-        c = (ColumnNode*) c->right; // Comenzar con una restricción diferente en cada hilo
-    } else {
-        // Luego elegir la restricción con menos opciones para satisfacer
-        for (ColumnNode* temp = (ColumnNode*) c->right; temp != _header; temp = (ColumnNode*) temp->right){
-            if (temp->size < c->size) c = temp;
+// Cuenta las soluciones sobre una copia de la lista, para poder resolver después
+int SudokuSolver_SequentialDLX::count_solutions(int limit /*=2*/){
+    int count = 0;
+    if (_consistent && limit > 0){
+        DLXInstance dlx(_dlx);
+        count_kernel(dlx, limit, count);
+    }
+    return count;
+}
+
+// Núcleo del conteo: igual que solve_kernel pero sigue buscando tras cada solución
+void SudokuSolver_SequentialDLX::count_kernel(DLXInstance& dlx, int limit, int& count){
+    std::vector<int> rows, columns;   // Pila explícita: fila y columna de cada nivel
+    while (true){
+        if (dlx.empty()){
+            ++count;
+        } else {
+            int c = dlx.selectColumn();
+            dlx.cover(c);
+            int r = dlx.down(c);
+            if (r != c){
+                columns.push_back(c);
+                rows.push_back(r);
+                dlx.coverRow(r);
+                continue;
+            }
+            dlx.uncover(c); // Restricción imposible de satisfacer
+        }
+        if (count >= limit){   // Límite alcanzado: no hace falta recorrer el resto del árbol
+            unwind(dlx, rows, columns);
+            return;
         }
+        if (!backtrack(dlx, rows, columns, nullptr)) { return; }
     }
-    return c;
 }
@@ -1,6 +1,7 @@
 #include "SudokuSolver_SequentialForwardChecking.hpp"  
 #include "helper.hpp"                                   
 #include <algorithm>                                    
+#include <limits>                                       
 #include <vector>                                       
 
 // Constructor del solucionador de Sudoku secuencial usando el algoritmo de "forward checking"
@@ -12,6 +13,7 @@ SudokuSolver_SequentialForwardChecking::SudokuSolver_SequentialForwardChecking(S
     }
     board.createStateMatrix(_stateMatrix);           // Crear la matriz de estado
     board.convertToStateMatrix(_stateMatrix);        // Convertir el tablero a matriz de estado
+    _stack.reserve(board.get_num_total_cells() + 1); // Cada nivel decide al menos una celda más
 }
 
 // Paso de propagación del algoritmo de "forward checking"
@@ -37,6 +39,7 @@ bool SudokuSolver_SequentialForwardChecking::propagate_step(StateMatrix& stateMa
                 std::set_difference(state.begin(), state.end(),
                                     setOfFilledValuesInRow.begin(), setOfFilledValuesInRow.end(),
                                     std::inserter(temp, temp.begin()));
+                _stats.eliminate(state.size() - temp.size());
                 stateMatrix[i][j] = temp;
                 if (state.size() == 1){
                     int val = selector(state);
@@ -68,6 +71,7 @@ bool SudokuSolver_SequentialForwardChecking::propagate_step(StateMatrix& stateMa
                 std::set_difference(state.begin(), state.end(),
                                     setOfFilledValuesInCol.begin(), setOfFilledValuesInCol.end(),
                                     std::inserter(temp, temp.begin()));
+                _stats.eliminate(state.size() - temp.size());
                 stateMatrix[i][j] = temp;
                 if (state.size() == 1){
                     int val = selector(state);
@@ -99,6 +103,7 @@ bool SudokuSolver_SequentialForwardChecking::propagate_step(StateMatrix& stateMa
                         std::set_difference(state.begin(), state.end(),
                                             setOfFilledValuesInBox.begin(), setOfFilledValuesInBox.end(),
                                             std::inserter(temp, temp.begin()));
+                        _stats.eliminate(state.size() - temp.size());
                         stateMatrix[i][j] = temp;
                         if (state.size() == 1){
                             int val = selector(state);
@@ -147,25 +152,62 @@ SudokuBoard SudokuSolver_SequentialForwardChecking::convertToSudokuGrid(StateMat
     return tmpBoard;
 }
 
-// Núcleo del algoritmo de "forward checking" para resolver el Sudoku
-void SudokuSolver_SequentialForwardChecking::solve_kernel(StateMatrix& stateMatrix){
+// Núcleo del algoritmo de "forward checking" para resolver el Sudoku. Al entrar en un nivel se propaga su matriz;
+// después se prueba cada valor de cada celda abierta apilando una copia de la matriz con ese valor
+void SudokuSolver_SequentialForwardChecking::solve_kernel(const StateMatrix& stateMatrix){
     if (_solved) return;
-    propagate(stateMatrix);
-    if (done(stateMatrix)){
-        _solved = true;
-        _solution = convertToSudokuGrid(stateMatrix);
-        return;
-    } else {
-        for (int i = 0; i < _board.get_board_size(); ++i){
-            for (int j = 0; j < _board.get_board_size(); ++j){
-                if (std::holds_alternative<std::set<int>>(stateMatrix[i][j])){   // Si el elemento stateMatrix[i][j] es de tipo std::set<int>
-                    for (const auto& value : std::get<std::set<int>>(stateMatrix[i][j])){
-                        StateMatrix newStateMatrix = stateMatrix;
-                        newStateMatrix[i][j] = value;
-                        solve_kernel(newStateMatrix);
+    const int BOARD_SIZE = _board.get_board_size();
+    _stack.clear();
+    _stack.push_back({ stateMatrix, 0, 0 });
+    bool descend = true;
+    while (!_stack.empty()){
+        Frame& top = _stack.back();
+        if (descend){
+            int depth = _stack.size() - 1;  // Decisiones desde la raíz
+            if (out_of_budget()) { _stack.clear(); return; }  // Límite de tiempo, nodos o memoria alcanzado
+            _stats.node(depth);
+            propagate(top.stateMatrix);
+            if (done(top.stateMatrix)){
+                _solved = true;
+                _solution = convertToSudokuGrid(top.stateMatrix);
+                _stack.clear();
+                return;
+            }
+            if constexpr (SearchStats::enabled) {   // Factor de ramificación: se prueba cada candidato de cada celda abierta
+                int children = 0;
+                for (const auto& row : top.stateMatrix){
+                    for (const auto& e : row){
+                        if (std::holds_alternative<std::set<int>>(e)) { children += std::get<std::set<int>>(e).size(); }
                     }
                 }
+                _stats.branch(depth, children);
+            }
+            top.cell = 0;
+            top.value = std::numeric_limits<int>::min();
+        }
+
+        // Buscar el siguiente valor de la celda actual o de la siguiente celda abierta
+        descend = false;
+        for (; top.cell < BOARD_SIZE * BOARD_SIZE; ++top.cell, top.value = std::numeric_limits<int>::min()){
+            const MultiType& e = top.stateMatrix[top.cell / BOARD_SIZE][top.cell % BOARD_SIZE];
+            if (!std::holds_alternative<std::set<int>>(e)) { continue; }   // Celda ya decidida
+            const std::set<int>& values = std::get<std::set<int>>(e);
+            auto next = values.upper_bound(top.value);
+            if (next != values.end()){
+                top.value = *next;
+                descend = true;
+                break;
             }
         }
+        if (descend){
+            StateMatrix newStateMatrix = top.stateMatrix;
+            newStateMatrix[top.cell / BOARD_SIZE][top.cell % BOARD_SIZE] = top.value;
+            _stack.push_back({ std::move(newStateMatrix), 0, 0 });   // top deja de ser válido a partir de aquí
+            continue;
+        }
+
+        // No quedan valores por probar en este nivel: volver al padre
+        _stack.pop_back();
+        if (!_stack.empty()) { _stats.backtrack(); }
     }
 }
@@ -1,11 +1,80 @@
-#include "SudokuTest.hpp" 
+#include "SudokuTest.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <omp.h>
+
+namespace {
+
+// Resultado de recorrer un tablero con las máscaras de sus unidades
+struct UnitScan {
+    bool inRange = true;       // Todas las celdas llenas tienen un valor entre 1 y N
+    bool rows = true;          // Ninguna fila repite un número
+    bool columns = true;       // Ninguna columna repite un número
+    bool boxes = true;         // Ninguna caja repite un número
+    bool complete = true;      // No quedan celdas vacías
+    bool givens = true;        // Se respetan las pistas del puzle (si se pasa uno)
+};
+
+// Recorre el tablero una sola vez. Cada fila, columna y caja tiene una máscara de (N + 63) / 64 palabras,
+// guardadas seguidas por unidad; un número repetido se detecta porque su bit ya estaba puesto, y los
+// repetidos se acumulan sin saltos para no cortar el bucle interior.
+UnitScan scan_units(const SudokuBoard& board, const SudokuBoard* puzzle){
+    UnitScan scan;
+    const int N = board.get_board_size();
+    const int B = board.get_box_size();
+    if (N <= 0 || B <= 0) { return scan; }
+
+    const int W = (N + 63) / 64;
+    const int boxesPerRow = (N + B - 1) / B;   // Cajas incompletas si el tamaño no es un cuadrado
+    std::vector<std::uint64_t> rowMask(N * W, 0), colMask(N * W, 0), boxMask(boxesPerRow * boxesPerRow * W, 0);
+    std::uint64_t rowDup = 0, colDup = 0, boxDup = 0;
+    int empty = 0;
+    bool inRange = true, givens = true;
+
+    const SudokuBoard::Cell* cells = board.data();
+    const SudokuBoard::Cell* clues = (puzzle != nullptr) ? puzzle->data() : nullptr;
+    const int EMPTY = board.get_empty_cell_value();
+
+    for (int row = 0; row < N; ++row){
+        std::uint64_t* rowWords = &rowMask[row * W];
+        std::uint64_t* boxRow = &boxMask[(row / B) * boxesPerRow * W];
+        for (int col = 0; col < N; ++col){
+            int cell = row * N + col;
+            int val = cells[cell];
+            if (clues != nullptr) { givens = givens && (clues[cell] == EMPTY || clues[cell] == val); }
+            if (val == EMPTY) { ++empty; continue; }
+            if (val > N) { inRange = false; continue; }   // Cell no tiene signo: los negativos también caen aquí
+
+            int word = (val - 1) >> 6;
+            std::uint64_t bit = std::uint64_t(1) << ((val - 1) & 63);
+            std::uint64_t& r = rowWords[word];
+            std::uint64_t& c = colMask[col * W + word];
+            std::uint64_t& b = boxRow[(col / B) * W + word];
+            rowDup |= r & bit;
+            colDup |= c & bit;
+            boxDup |= b & bit;
+            r |= bit;
+            c |= bit;
+            b |= bit;
+        }
+    }
+
+    scan.inRange = inRange;
+    scan.rows = inRange && rowDup == 0;
+    scan.columns = inRange && colDup == 0;
+    scan.boxes = inRange && boxDup == 0;
+    scan.complete = (empty == 0);
+    scan.givens = givens;
+    return scan;
+}
+
+} // namespace
 
 // Devuelve si las dimensiones del tablero de Sudoku son válidas.
 bool SudokuTest::checkValidSizes(const SudokuBoard& board){
     int BOARD_SIZE = board._BOARD_SIZE;
-    int ROW_SIZE = board._board_data.size();
-    int COL_SIZE = board._board_data[0].size(); 
-    if ((ROW_SIZE != BOARD_SIZE) || (COL_SIZE != BOARD_SIZE)){
+    int NUM_CELLS = (int)board._cells.size() - board.num_mask_words();   // Detrás de las celdas van las máscaras
+    if (BOARD_SIZE <= 0 || NUM_CELLS != BOARD_SIZE * BOARD_SIZE){
         return false;
     }
     return true;
@@ -13,47 +82,61 @@ bool SudokuTest::checkValidSizes(const SudokuBoard& board){
 
 // Devuelve si todas las filas son válidas, es decir, si no contienen números duplicados.
 bool SudokuTest::checkValidRows(const SudokuBoard& board){
-    for (int row = 0; row < board._BOARD_SIZE; ++row){
-        std::set<int> valuesInRow;
-        for (int col = 0; col < board._BOARD_SIZE; ++col){
-            int val = board._board_data[row][col];
-            if (val == board._EMPTY_CELL_VALUE) { continue; }
-            if (valuesInRow.find(val) != valuesInRow.end()) { return false; }
-            valuesInRow.insert(val);
-        }
-    }
-    return true;
+    return scan_units(board, nullptr).rows;
 }
 
 // Devuelve si todas las columnas son válidas, es decir, si no contienen números duplicados.
 bool SudokuTest::checkValidColumns(const SudokuBoard& board){
-    for (int col = 0; col < board._BOARD_SIZE; ++col){
-        std::set<int> valuesInCol;
-        for (int row = 0; row < board._BOARD_SIZE; ++row){
-            int val = board._board_data[row][col];
-            if (val == board._EMPTY_CELL_VALUE) { continue; }
-            if (valuesInCol.find(val) != valuesInCol.end()) { return false; }
-            valuesInCol.insert(val);
-        }
-    }
-    return true;
+    return scan_units(board, nullptr).columns;
 }
 
 // Devuelve si todas las cajas (subcuadrículas) son válidas, es decir, si no contienen números duplicados.
 bool SudokuTest::checkValidBoxes(const SudokuBoard& board){
-    int BOX_SIZE = board._BOX_SIZE;
-    for (int box_x = 0; box_x < BOX_SIZE; ++box_x){
-        for (int box_y = 0; box_y < BOX_SIZE; ++box_y){
-            std::set<int> valuesInBox;
-            for (int m = 0; m < BOX_SIZE; ++m){
-                for (int n = 0; n < BOX_SIZE; ++n){
-                    int val = board._board_data[box_x * BOX_SIZE + m][box_y * BOX_SIZE + n];
-                    if (val == board._EMPTY_CELL_VALUE) { continue; }
-                    if (valuesInBox.find(val) != valuesInBox.end()) { return false; }
-                    valuesInBox.insert(val);
-                }
-            }
-        }
+    return scan_units(board, nullptr).boxes;
+}
+
+// Devuelve si el tablero tiene un tamaño válido y ninguna unidad repite números.
+bool SudokuTest::checkValidBoard(const SudokuBoard& board){
+    if (!checkValidSizes(board)) { return false; }
+    UnitScan scan = scan_units(board, nullptr);
+    return scan.rows && scan.columns && scan.boxes;
+}
+
+// Devuelve si la solución corresponde al puzle: mismo tamaño, completa, válida y con las mismas pistas.
+bool SudokuTest::checkSolution(const SudokuBoard& puzzle, const SudokuBoard& solution){
+    if (!checkValidSizes(solution) || puzzle.get_board_size() != solution.get_board_size() || !checkValidSizes(puzzle)) { return false; }
+    UnitScan scan = scan_units(solution, &puzzle);
+    return scan.complete && scan.givens && scan.rows && scan.columns && scan.boxes;
+}
+
+// Verifica un lote de tableros en paralelo.
+int SudokuTest::checkValidBoards(const std::vector<SudokuBoard>& boards, std::vector<char>& valid, int num_threads){
+    int count = boards.size();
+    valid.assign(count, 0);
+    if (num_threads <= 0) { num_threads = omp_get_max_threads(); }
+
+    int invalid = 0;
+    #pragma omp parallel for schedule(static) num_threads(num_threads) default(none) shared(boards, valid, count) reduction(+:invalid)
+    for (int i = 0; i < count; ++i){
+        valid[i] = checkValidBoard(boards[i]);
+        invalid += !valid[i];
     }
-    return true;
+    return invalid;
+}
+
+// Verifica un lote de pares puzle/solución en paralelo.
+int SudokuTest::checkSolutions(const std::vector<SudokuBoard>& puzzles, const std::vector<SudokuBoard>& solutions,
+                               std::vector<char>& valid, int num_threads){
+    int count = solutions.size();
+    int paired = std::min<int>(count, puzzles.size());
+    valid.assign(count, 0);
+    if (num_threads <= 0) { num_threads = omp_get_max_threads(); }
+
+    int invalid = count - paired;   // Soluciones sin puzle
+    #pragma omp parallel for schedule(static) num_threads(num_threads) default(none) shared(puzzles, solutions, valid, paired) reduction(+:invalid)
+    for (int i = 0; i < paired; ++i){
+        valid[i] = checkSolution(puzzles[i], solutions[i]);
+        invalid += !valid[i];
+    }
+    return invalid;
 }
@@ -0,0 +1,85 @@
+#include "SudokuUniqueness.hpp"
+#include "BitBoard.hpp"
+#include "SudokuSolver_SequentialDLX.hpp"
+#include "SudokuSolver_ParallelDLX.hpp"
+#include <vector>
+#include <omp.h>
+
+// Número de subárboles por hilo: con más subárboles que hilos el reparto dinámico equilibra mejor la carga
+#define SUBTREES_PER_THREAD 8
+
+// Tamaño de tablero máximo para el que se cuenta con el backtracking con máscaras de bits (el que admite BitBoard)
+#define UNIQUENESS_BITBOARD_MAX_SIZE BitBoard::MAX_BOARD_SIZE
+
+namespace {
+
+// Reparte el conteo entre los hilos: expande la frontera por niveles hasta tener suficientes subárboles (o hasta
+// que no queden celdas) y cuenta cada subárbol por separado
+template <class Bitboard>
+int count_parallel(const Bitboard& root, int limit, int num_threads)
+{
+    int count = 0;
+    std::vector<Bitboard> frontier(1, root);
+    while (!frontier.empty() && (int) frontier.size() < SUBTREES_PER_THREAD * num_threads)
+    {
+        std::vector<Bitboard> next;
+        for (const Bitboard& bitboard : frontier)
+        {
+            if (bitboard.get_num_empty_cells() == 0) { ++count; }   // Solución encontrada durante la expansión
+            else { bitboard.branch(next); }
+        }
+        frontier.swap(next);
+        if (count >= limit) { return limit; }
+    }
+
+    int numberOfSubtrees = frontier.size();
+    int found = count;   // Soluciones encontradas hasta ahora por todos los hilos
+
+    #pragma omp parallel for schedule(dynamic, 1) num_threads(num_threads) default(none) \
+        shared(frontier, numberOfSubtrees, limit, found) reduction(+:count)
+    for (int i = 0; i < numberOfSubtrees; ++i)
+    {
+        int alreadyFound;
+        #pragma omp atomic read
+        alreadyFound = found;
+        if (alreadyFound >= limit) { continue; }   // Ya se alcanzó el límite: el resto de subárboles sobra
+
+        int local = frontier[i].count_solutions(limit - alreadyFound);
+
+        #pragma omp atomic
+        found += local;
+        count += local;
+    }
+
+    return (count < limit) ? count : limit;
+}
+
+}
+
+// Cuenta las soluciones hasta limit, en paralelo si num_threads > 1
+int count_solutions(const SudokuBoard& board, int limit /*=2*/, int num_threads /*=1*/)
+{
+    if (limit <= 0) { return 0; }
+    if (board.get_board_size() > UNIQUENESS_BITBOARD_MAX_SIZE)
+    {
+        SudokuBoard copy(board);
+        if (num_threads <= 1)
+        {
+            return SudokuSolver_SequentialDLX(copy, false).count_solutions(limit);
+        }
+        return SudokuSolver_ParallelDLX(copy, false).count_solutions(limit, num_threads);
+    }
+
+    // El tamaño de caja se despacha una vez: hasta 36x36 el conteo usa BasicBitBoard<2..6>, y por encima BitBoard
+    return with_bitboard(board, [limit, num_threads](auto& root) {
+        if (!root.is_consistent()) { return 0; }
+        if (num_threads <= 1) { return root.count_solutions(limit); }
+        return count_parallel(root, limit, num_threads);
+    });
+}
+
+// Un sudoku válido para publicar tiene exactamente una solución
+bool has_unique_solution(const SudokuBoard& board, int num_threads /*=1*/)
+{
+    return count_solutions(board, 2, num_threads) == 1;
+}
@@ -0,0 +1,181 @@
+#ifndef BITBOARD_HPP
+#define BITBOARD_HPP
+
+#include "SudokuBoard.hpp"
+#include "SearchStats.hpp"
+#include "SolveOptions.hpp"
+#include "PeerTable.hpp"
+#include <array>
+#include <cstdint>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Representación del tablero con máscaras de bits por fila, columna y caja, para el backtracking rápido.
+// El bit (num - 1) de una máscara indica que el número num ya está usado en esa unidad, así que los
+// candidatos de una celda se obtienen con un OR y un NOT. Admite tableros de hasta 64 x 64.
+//
+// BOX fija el tamaño de caja en compilación (2 a 6): los límites de los bucles, el ancho de las máscaras y la
+// fila/columna/caja de cada celda son constantes y el estado vive en arreglos fijos, así que el compilador
+// puede desenrollar y vectorizar los caminos de 9x9 y 16x16. BOX = 0 (BitBoard) es la versión de ejecución
+// para cualquier tamaño. Todas recorren el árbol en el mismo orden (mismo MRV y mismo desempate) con pilas
+// explícitas; with_bitboard elige la versión a partir del tablero.
+template <int BOX>
+class BasicBitBoard {
+public:
+    static constexpr bool FIXED = (BOX > 0);
+    static constexpr int MAX_BOARD_SIZE = 64;
+
+    // Máscara de 32 bits hasta 32 valores si el tamaño es fijo; de 64 bits en los demás casos
+    using Mask = std::conditional_t<(FIXED && BOX * BOX <= 32), std::uint32_t, std::uint64_t>;
+
+    static_assert(BOX >= 0 && BOX * BOX <= MAX_BOARD_SIZE, "BasicBitBoard admite tableros de hasta 64 x 64");
+
+private:
+    static constexpr int FIXED_SIZE = BOX * BOX;              // Tamaño del tablero (0 = de ejecución)
+    static constexpr int FIXED_CELLS = FIXED_SIZE * FIXED_SIZE;
+
+    // Una entrada por celda o por unidad: arreglo fijo si el tamaño se conoce en compilación
+    template <class T, int SIZE>
+    using Storage = std::conditional_t<FIXED, std::array<T, SIZE>, std::vector<T>>;
+
+    // Punto de elección de la búsqueda
+    struct Frame {
+        int cell;          // Celda elegida (MRV)
+        int num;           // Número colocado actualmente (0 = ninguno)
+        Mask remaining;    // Candidatos que quedan por probar
+        int forced;        // Celdas forzadas por la propagación antes de este nivel (solo count_solutions)
+    };
+
+    int _BOARD_SIZE = FIXED_SIZE;               // Tamaño del tablero
+    Mask _full = 0;                             // Máscara con los _BOARD_SIZE bits de valores posibles
+    bool _consistent = true;                    // false si las pistas del tablero se contradicen
+    const PeerTable* _table = nullptr;          // Fila, columna y caja de cada celda (solo BOX = 0)
+    Storage<std::uint8_t, FIXED_CELLS> _cells{}; // Valor de cada celda (0 = vacía), en orden fila a fila
+    Storage<Mask, FIXED_SIZE> _rowMask{};       // Números usados en cada fila
+    Storage<Mask, FIXED_SIZE> _colMask{};       // Números usados en cada columna
+    Storage<Mask, FIXED_SIZE> _boxMask{};       // Números usados en cada caja
+    Storage<std::uint16_t, FIXED_CELLS> _empty{}; // Celdas vacías: las _numEmpty primeras siguen vacías
+    int _numEmpty = 0;                          // Número de celdas vacías
+    int _initialEmpty = 0;                      // Celdas vacías del tablero de partida
+    SearchStats _stats;                         // Estadísticas de solve() (vacías salvo con SUDOKU_SEARCH_STATS)
+    SolveBudget* _budget = nullptr;             // Límites de solve() (nullptr = sin límites)
+
+    int row_of(int cell) const {
+        if constexpr (FIXED) { return PEER_TABLE_DATA<BOX>.row[cell]; } else { return _table->row_of(cell); }
+    }
+    int col_of(int cell) const {
+        if constexpr (FIXED) { return PEER_TABLE_DATA<BOX>.col[cell]; } else { return _table->col_of(cell); }
+    }
+    int box_of(int cell) const {
+        if constexpr (FIXED) { return PEER_TABLE_DATA<BOX>.box[cell]; } else { return _table->box_of(cell); }
+    }
+
+    // Rellena los singles desnudos y ocultos hasta que no quede ninguno. Cada celda rellenada sale de la zona de
+    // vacías como en take_cell y suma uno a forced; devuelve false si una celda o una unidad se queda sin
+    // candidatos. once y twice son espacio de trabajo de 3 * N máscaras (filas, columnas y cajas)
+    bool propagate(int& forced, Mask* once, Mask* twice);
+    // Deshace las celdas forzadas hasta dejar mark, en orden inverso
+    void unforce(int& forced, int mark);
+
+public:
+    static int popcount(Mask m) {
+        if constexpr (sizeof(Mask) == 4) { return __builtin_popcount(m); } else { return __builtin_popcountll(m); }
+    }
+    static int lowest(Mask m) {
+        if constexpr (sizeof(Mask) == 4) { return __builtin_ctz(m); } else { return __builtin_ctzll(m); }
+    }
+
+    BasicBitBoard() = default;
+    explicit BasicBitBoard(const SudokuBoard& board);   // Constructor que carga las pistas del tablero
+
+    bool is_consistent() const { return _consistent; }
+    int get_board_size() const { if constexpr (FIXED) { return FIXED_SIZE; } else { return _BOARD_SIZE; } }
+    int get_num_empty_cells() const { return _numEmpty; }
+    int at(int cell) const { return _cells[cell]; }
+    const SearchStats& get_stats() const { return _stats; }
+    void set_budget(SolveBudget* budget) { _budget = budget; }
+
+    // Candidatos de una celda vacía
+    Mask candidates(int cell) const {
+        return _full & ~(_rowMask[row_of(cell)] | _colMask[col_of(cell)] | _boxMask[box_of(cell)]);
+    }
+
+    // Coloca/quita el número num en la celda (actualizando las máscaras)
+    void place(int cell, int num) {
+        Mask bit = Mask(1) << (num - 1);
+        _cells[cell] = (std::uint8_t)num;
+        _rowMask[row_of(cell)] |= bit;
+        _colMask[col_of(cell)] |= bit;
+        _boxMask[box_of(cell)] |= bit;
+    }
+    void remove(int cell, int num) {
+        Mask bit = ~(Mask(1) << (num - 1));
+        _cells[cell] = 0;
+        _rowMask[row_of(cell)] &= bit;
+        _colMask[col_of(cell)] &= bit;
+        _boxMask[box_of(cell)] &= bit;
+    }
+
+    // Elige la celda vacía con menos candidatos (MRV) y la saca de la lista de vacías.
+    // Devuelve la celda y sus candidatos; restore_cell() la devuelve a la lista al retroceder.
+    int take_cell(Mask& cellCandidates);
+    void restore_cell() { ++_numEmpty; }
+
+    // Orden de la lista de vacías: el desempate de take_cell depende de él, así que una búsqueda guardada lo
+    // necesita para continuar igual. Las celdas tomadas están al final, la del primer nivel en la última posición
+    std::vector<int> get_empty_order() const { return std::vector<int>(_empty.begin(), _empty.begin() + _initialEmpty); }
+    // Restaura un orden guardado sobre un tablero sin celdas tomadas; false si no son sus celdas vacías
+    bool set_empty_order(const std::vector<int>& order);
+    // Vuelve a tomar la última celda de la zona de vacías, para repetir una búsqueda con el orden restaurado
+    int retake_cell() { return _empty[--_numEmpty]; }
+
+    // Busca la primera solución; si la encuentra deja el tablero completo. Devuelve false también si se agota
+    // el presupuesto (véase SolveBudget::exhausted)
+    bool solve();
+
+    // Cuenta las soluciones hasta llegar a limit (basta limit = 2 para comprobar unicidad). A diferencia de
+    // solve(), propaga los singles en cada nodo: el orden del recorrido no importa al contar. Si se agota el
+    // presupuesto devuelve las soluciones encontradas hasta entonces
+    int count_solutions(int limit = 2);
+
+    // Rellena las celdas vacías con una solución elegida al azar: prueba los candidatos de cada celda en orden
+    // aleatorio y propaga los singles como count_solutions(). Tras max_nodes asignaciones sin llegar a una
+    // solución se rinde, deja el tablero como estaba y devuelve false (para volver a empezar con otro orden)
+    bool fill_random(std::mt19937& rng, long long max_nodes);
+
+    // Ramifica la celda con menos candidatos: añade un tablero hijo por cada candidato
+    void branch(std::vector<BasicBitBoard>& children) const;
+
+    // Copia los valores de las celdas en un SudokuBoard del mismo tamaño
+    void write_to(SudokuBoard& board) const;
+};
+
+// Versión de ejecución, para cualquier tamaño de hasta 64 x 64
+using BitBoard = BasicBitBoard<0>;
+
+// Las instancias se compilan una sola vez en BitBoard.cpp
+extern template class BasicBitBoard<0>;
+extern template class BasicBitBoard<2>;
+extern template class BasicBitBoard<3>;
+extern template class BasicBitBoard<4>;
+extern template class BasicBitBoard<5>;
+extern template class BasicBitBoard<6>;
+
+// Cualquiera de las versiones; make_bitboard construye la del tamaño de caja del tablero (la de ejecución si no
+// hay versión fija o el tamaño no es un cuadrado)
+using AnyBitBoard = std::variant<BitBoard, BasicBitBoard<2>, BasicBitBoard<3>, BasicBitBoard<4>,
+                                 BasicBitBoard<5>, BasicBitBoard<6>>;
+AnyBitBoard make_bitboard(const SudokuBoard& board);
+
+// Llama a f con el tablero de bits del tamaño del tablero: el tamaño se despacha una sola vez aquí y dentro
+// de f ya es una constante. Devuelve lo que devuelva f
+template <class F>
+auto with_bitboard(const SudokuBoard& board, F&& f) {
+    AnyBitBoard bitboard = make_bitboard(board);
+    return std::visit(std::forward<F>(f), bitboard);
+}
+
+#endif // BITBOARD_HPP
@@ -0,0 +1,158 @@
+#ifndef DLXTEMPLATE_HPP
+#define DLXTEMPLATE_HPP
+
+#include "SudokuBoard.hpp"
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+
+// Plantilla inmutable de la lista DLX para un tamaño de tablero dado.
+// Para un mismo tamaño la estructura de cobertura exacta es idéntica entre sudokus: solo cambian las filas
+// eliminadas por las pistas. Por eso la construimos una única vez y cada sudoku copia los enlaces con memcpy.
+//
+// Los enlaces se guardan como índices (no punteros) en un único bloque contiguo:
+//     [ L | R | U | D | C | S ]
+// donde el nodo 0 es la cabecera, los nodos 1.._numberOfColumns son las columnas y cada fila de la matriz
+// de cobertura ocupa 4 nodos consecutivos (celda, fila, columna, caja) a partir de get_first_row_node().
+//
+// A partir de DISK_CACHE_MIN_BOARD_SIZE la plantilla se guarda además en un archivo binario versionado
+// (dlx_<N>_v<FILE_VERSION>.bin) que las siguientes ejecuciones proyectan en memoria de solo lectura en vez de reconstruirla.
+// La proyección solo ahorra la construcción: cada DLXInstance sigue copiando el bloque (unos 1,3 MB en 25x25,
+// ~0,1 ms frente a 0,5-2 ms de una resolución), porque bailar los enlaces los modifica. Una proyección privada
+// de copia en escritura por instancia sería más cara: solo coverGivens ya escribe en unas 140 de las 320 páginas
+// y sus fallos de página cuestan ~0,5 ms; además no serviría para copiar una instancia a otra.
+class DLXTemplate {
+private:
+    int _BOARD_SIZE;        // Tamaño del tablero
+    int _BOX_SIZE;          // Tamaño de la caja (subgrilla)
+    int _numberOfColumns;   // _BOARD_SIZE * _BOARD_SIZE * 4 (celda, fila, columna, caja)
+    int _numberOfRows;      // _BOARD_SIZE * _BOARD_SIZE * _MAX_VALUE
+    int _numberOfNodes;     // 1 (cabecera) + _numberOfColumns + 4 * _numberOfRows
+    std::vector<int> _links; // Bloque contiguo con todos los enlaces (cuando se construye en memoria)
+    const int* _data;       // Inicio del bloque de enlaces (en _links o en el archivo proyectado)
+    std::size_t _size;      // Número de enteros del bloque de enlaces
+
+    // Proyección en memoria del archivo de caché (vacía si la plantilla se construyó en memoria)
+    void* _mappedAddress = nullptr;
+    std::size_t _mappedLength = 0;
+    void* _mappingHandle = nullptr;   // Solo se usa en Windows
+
+    DLXTemplate() = default;
+    void set_dimensions(int boardSize);
+
+public:
+    static const int NODES_PER_ROW = 4;             // Cada candidato cumple exactamente 4 restricciones
+    static const int DISK_CACHE_MIN_BOARD_SIZE = 25; // Tamaño a partir del cual se usa la caché en disco
+    static const std::uint32_t FILE_VERSION = 1;    // Incrementar al cambiar la disposición de los enlaces
+
+    // Construye la plantilla completa (sin pistas) para un tablero de tamaño boardSize
+    DLXTemplate(int boardSize);
+
+    // La plantilla puede poseer una proyección de archivo: no se copia
+    DLXTemplate(const DLXTemplate&) = delete;
+    DLXTemplate& operator= (const DLXTemplate&) = delete;
+    ~DLXTemplate();
+
+    // Devuelve la plantilla del tamaño pedido, construyéndola y guardándola en caché la primera vez.
+    // Para tamaños grandes intenta primero proyectar el archivo de caché y, si no existe, lo escribe.
+    static const DLXTemplate& get(int boardSize);
+
+    // Directorio de la caché en disco (variable de entorno SUDOKU_DLX_CACHE_DIR o el directorio actual)
+    static std::string cache_directory();
+    static std::string cache_file_name(int boardSize);
+
+    // Escribe la plantilla en un archivo binario versionado; devuelve false si no se pudo escribir
+    bool save(const std::string& filename) const;
+
+    // Proyecta en memoria (solo lectura) una plantilla guardada; devuelve nullptr si el archivo
+    // no existe, es de otra versión o no corresponde al tamaño pedido
+    static std::unique_ptr<DLXTemplate> load(const std::string& filename, int boardSize);
+
+    bool is_mapped() const { return _mappedAddress != nullptr; }
+
+    int get_board_size() const { return _BOARD_SIZE; }
+    int get_box_size() const { return _BOX_SIZE; }
+    int get_number_of_columns() const { return _numberOfColumns; }
+    int get_number_of_rows() const { return _numberOfRows; }
+    int get_number_of_nodes() const { return _numberOfNodes; }
+    int get_first_row_node() const { return 1 + _numberOfColumns; }
+
+    // Acceso al bloque de enlaces para copiarlo con memcpy
+    const int* data() const { return _data; }
+    std::size_t size() const { return _size; }
+
+    // Desplazamientos de cada arreglo dentro del bloque de enlaces
+    std::size_t offset_L() const { return 0; }
+    std::size_t offset_R() const { return (std::size_t) _numberOfNodes; }
+    std::size_t offset_U() const { return (std::size_t) _numberOfNodes * 2; }
+    std::size_t offset_D() const { return (std::size_t) _numberOfNodes * 3; }
+    std::size_t offset_C() const { return (std::size_t) _numberOfNodes * 4; }
+    std::size_t offset_S() const { return (std::size_t) _numberOfNodes * 5; }
+};
+
+// Copia de trabajo de una plantilla DLX para resolver un sudoku concreto.
+// Contiene las operaciones de cubrir/descubrir columnas del Algoritmo X sobre los arreglos de índices.
+class DLXInstance {
+private:
+    const DLXTemplate* _template = nullptr;  // Plantilla de origen
+    std::vector<int> _links;                 // Copia privada de los enlaces
+    int* L = nullptr;   // Nodo a la izquierda
+    int* R = nullptr;   // Nodo a la derecha
+    int* U = nullptr;   // Nodo de arriba
+    int* D = nullptr;   // Nodo de abajo
+    int* C = nullptr;   // Nodo columna al que pertenece cada nodo
+    int* S = nullptr;   // Tamaño de cada columna (indexado por nodo columna)
+
+    void bind();        // Recalcula los punteros L/R/U/D/C/S sobre _links
+
+public:
+    DLXInstance() = default;                          // Constructor por defecto
+    DLXInstance(const DLXTemplate& dlxTemplate);      // Constructor que copia la plantilla
+    DLXInstance(const DLXInstance& anotherInstance);  // Constructor de copia (memcpy + recálculo de punteros)
+
+    // Operador de asignación de copia
+    DLXInstance& operator= (const DLXInstance& anotherInstance);
+
+    // Restablece la instancia al estado de la plantilla (sin pistas) reutilizando la memoria reservada
+    void reset(const DLXTemplate& dlxTemplate);
+
+    // Cubre las filas correspondientes a las pistas del tablero.
+    // Devuelve false si dos pistas entran en conflicto (el sudoku no tiene solución).
+    bool coverGivens(const SudokuBoard& board);
+
+    // Cubrir/descubrir una columna (Algoritmo X)
+    void cover(int c);
+    void uncover(int c);
+
+    // Cubre/descubre todas las demás columnas de la fila del nodo r
+    void coverRow(int r);
+    void uncoverRow(int r);
+
+    // Selecciona la columna con menos opciones (heurística MRV)
+    int selectColumn() const;
+
+    // Funciones de consulta sobre la estructura
+    int header() const { return 0; }
+    bool empty() const { return R[0] == 0; }
+    bool isActive(int c) const { return R[L[c]] == c; }
+    int right(int n) const { return R[n]; }
+    int left(int n) const { return L[n]; }
+    int down(int n) const { return D[n]; }
+    int up(int n) const { return U[n]; }
+    int column(int n) const { return C[n]; }
+    int columnSize(int c) const { return S[c]; }
+    const DLXTemplate& get_template() const { return *_template; }
+
+    // Índice de la fila de la matriz de cobertura a la que pertenece un nodo
+    int coverRowOf(int n) const { return (n - _template->get_first_row_node()) / DLXTemplate::NODES_PER_ROW; }
+
+    // Primer nodo de la fila de cobertura (row, col, num)
+    int rowNode(int row, int col, int num) const;
+
+    // Escribe en el tablero el candidato (fila, columna, número) representado por un nodo
+    void applyToBoard(int n, SudokuBoard& board) const;
+};
+
+#endif // DLXTEMPLATE_HPP
@@ -0,0 +1,12 @@
+#ifndef FILEUTILS_HPP
+#define FILEUTILS_HPP
+
+#include <string>
+
+// Sustituye filename por tmpFilename, un archivo temporal ya escrito y cerrado: si el proceso muere a mitad de
+// la escritura queda el archivo anterior. En Windows rename no sobrescribe, así que se borra antes el destino.
+// Devuelve false si no se pudo (el destino sigue abierto en otro proceso, u otro proceso ya lo escribió); en ese
+// caso borra el temporal
+bool replace_file(const std::string& tmpFilename, const std::string& filename);
+
+#endif // FILEUTILS_HPP
@@ -0,0 +1,91 @@
+#ifndef PARALLELTRACE_HPP
+#define PARALLELTRACE_HPP
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+// Evento de la traza: con fase 'X' un intervalo [ts, ts + dur], con fase 'i' un instante
+struct TraceEvent {
+    const char* name;   // Literal de cadena (no se copia)
+    char phase;
+    double ts;          // Microsegundos desde el inicio de la traza
+    double dur;
+    int arg;            // Dato del evento (índice del subtablero, profundidad...), -1 si no tiene
+};
+
+// Línea de tiempo de la actividad de los solucionadores paralelos, exportable como JSON de Chrome trace
+// (chrome://tracing o https://ui.perfetto.dev). Cada hilo de OpenMP escribe solo en su propio búfer, sin
+// cerrojos ni atómicos; los búferes se juntan al guardar, cuando ya no hay regiones paralelas activas.
+// Mientras no haya una traza activa (start) los solucionadores solo comprueban un puntero.
+//
+// Eventos que registran los solucionadores:
+//   frontier  expansión de la frontera antes de repartir el trabajo
+//   subboard  resolución de un subtablero o subárbol (arg = índice)
+//   task      ejecución de una tarea recursiva (arg = profundidad)
+//   spawn     creación de una tarea (instante)
+//   steal     tarea ejecutada por un hilo distinto del que la creó (instante)
+//   cancel    iteración descartada porque otro hilo ya encontró la solución (instante)
+//   idle      espera en la barrera final de la región paralela
+class ParallelTrace {
+private:
+    static ParallelTrace* _active;                   // Traza en la que se registran los eventos (nullptr = ninguna)
+    std::chrono::steady_clock::time_point _origin;   // Instante cero de la traza
+    std::vector<std::vector<TraceEvent>> _buffers;   // Un búfer por número de hilo
+
+public:
+    static const int MAX_THREADS = 256;   // Los eventos de hilos con número mayor se descartan
+
+    ParallelTrace();
+
+    // Traza activa, o nullptr si no se está trazando
+    static ParallelTrace* active() { return _active; }
+
+    // Activa/desactiva esta traza. Solo deben llamarse fuera de las regiones paralelas
+    void start() { _active = this; }
+    void stop() { if (_active == this) { _active = nullptr; } }
+
+    // Microsegundos desde el inicio de la traza
+    double now() const;
+
+    // Registra un intervalo o un instante en el búfer del hilo que llama
+    void complete(const char* name, double begin, double end, int arg = -1);
+    void instant(const char* name, int arg = -1);
+
+    // Número total de eventos registrados
+    size_t size() const;
+
+    // Escribe la traza en formato JSON de Chrome trace
+    bool save(const std::string& filename) const;
+
+private:
+    std::vector<TraceEvent>* buffer();
+};
+
+// Registra como intervalo el tiempo de vida del objeto si hay una traza activa
+class TraceScope {
+private:
+    ParallelTrace* _trace;
+    const char* _name;
+    int _arg;
+    double _begin = 0.0;
+
+public:
+    TraceScope(const char* name, int arg = -1)
+        : _trace(ParallelTrace::active()), _name(name), _arg(arg)
+    {
+        if (_trace) { _begin = _trace->now(); }
+    }
+    ~TraceScope() {
+        if (_trace) { _trace->complete(_name, _begin, _trace->now(), _arg); }
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+};
+
+// Registra un instante en la traza activa (si la hay)
+inline void trace_instant(const char* name, int arg = -1) {
+    if (ParallelTrace* trace = ParallelTrace::active()) { trace->instant(name, arg); }
+}
+
+#endif // PARALLELTRACE_HPP
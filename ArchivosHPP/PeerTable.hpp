@@ -0,0 +1,129 @@
+#ifndef PEERTABLE_HPP
+#define PEERTABLE_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// Tablas de unidades y vecinos de un tablero con cajas de tamaño BOX. Las unidades se numeran seguidas:
+// filas 0..N-1, columnas N..2N-1 y cajas 2N..3N-1. Los vecinos de cada celda van en tres tramos: los N-1
+// de su fila, los N-1 de su columna y los (BOX-1)^2 de su caja que no están en ninguna de las dos.
+template <int BOX>
+struct PeerTableData {
+    static constexpr int BOARD_SIZE = BOX * BOX;
+    static constexpr int NUM_CELLS = BOARD_SIZE * BOARD_SIZE;
+    static constexpr int NUM_PEERS = 2 * (BOARD_SIZE - 1) + (BOX - 1) * (BOX - 1);
+
+    std::array<std::uint16_t, NUM_CELLS> row{}, col{}, box{};     // Fila, columna y caja de cada celda
+    std::array<std::uint16_t, 3 * NUM_CELLS> unitCells{};          // N celdas por unidad
+    std::array<std::uint16_t, NUM_CELLS * NUM_PEERS> peers{};      // NUM_PEERS vecinos por celda
+};
+
+// Genera las tablas en compilación
+template <int BOX>
+constexpr PeerTableData<BOX> make_peer_table_data() {
+    constexpr int N = PeerTableData<BOX>::BOARD_SIZE;
+    PeerTableData<BOX> data{};
+    for (int cell = 0; cell < N * N; ++cell) {
+        int row = cell / N, col = cell % N, box = (row / BOX) * BOX + col / BOX;
+        int boxCell = (row % BOX) * BOX + col % BOX;   // Posición de la celda dentro de su caja
+        data.row[cell] = (std::uint16_t)row;
+        data.col[cell] = (std::uint16_t)col;
+        data.box[cell] = (std::uint16_t)box;
+        data.unitCells[row * N + col] = (std::uint16_t)cell;
+        data.unitCells[(N + col) * N + row] = (std::uint16_t)cell;
+        data.unitCells[(2 * N + box) * N + boxCell] = (std::uint16_t)cell;
+
+        int k = cell * PeerTableData<BOX>::NUM_PEERS;
+        for (int c = 0; c < N; ++c) { if (c != col) { data.peers[k++] = (std::uint16_t)(row * N + c); } }
+        for (int r = 0; r < N; ++r) { if (r != row) { data.peers[k++] = (std::uint16_t)(r * N + col); } }
+        for (int r = row - row % BOX; r < row - row % BOX + BOX; ++r) {
+            for (int c = col - col % BOX; c < col - col % BOX + BOX; ++c) {
+                if (r != row && c != col) { data.peers[k++] = (std::uint16_t)(r * N + c); }
+            }
+        }
+    }
+    return data;
+}
+
+// Una sola copia de las tablas de cada tamaño para todo el programa
+template <int BOX>
+inline constexpr PeerTableData<BOX> PEER_TABLE_DATA = make_peer_table_data<BOX>();
+
+// Vista de las tablas para un tamaño conocido solo en ejecución. Las cajas de 2 a 6 apuntan a las tablas
+// generadas en compilación; los demás tamaños se construyen una vez con el mismo formato.
+class PeerTable {
+public:
+    // Rango de índices de celda
+    struct CellRange {
+        const std::uint16_t* first;
+        const std::uint16_t* last;
+        const std::uint16_t* begin() const { return first; }
+        const std::uint16_t* end() const { return last; }
+        int size() const { return (int)(last - first); }
+        int operator[](int k) const { return first[k]; }
+    };
+
+private:
+    int _BOX_SIZE;                          // Tamaño de la caja
+    int _BOARD_SIZE;                        // Tamaño del tablero
+    int _NUM_PEERS;                         // Vecinos por celda
+    const std::uint16_t* _row;              // Fila de cada celda
+    const std::uint16_t* _col;              // Columna de cada celda
+    const std::uint16_t* _box;              // Caja de cada celda
+    const std::uint16_t* _unitCells;        // Celdas de cada unidad
+    const std::uint16_t* _peers;            // Vecinos de cada celda
+    std::vector<std::uint16_t> _storage;    // Tablas de los tamaños construidos en ejecución
+
+    template <int BOX>
+    explicit PeerTable(const PeerTableData<BOX>& data)
+        : _BOX_SIZE(BOX), _BOARD_SIZE(BOX * BOX), _NUM_PEERS(PeerTableData<BOX>::NUM_PEERS),
+          _row(data.row.data()), _col(data.col.data()), _box(data.box.data()),
+          _unitCells(data.unitCells.data()), _peers(data.peers.data()) { }
+
+    explicit PeerTable(int boxSize);        // Construye las tablas en ejecución
+
+public:
+    PeerTable(const PeerTable&) = delete;
+    PeerTable& operator=(const PeerTable&) = delete;
+
+    // Devuelve las tablas del tamaño de caja dado (las de ejecución se construyen una sola vez por proceso)
+    static const PeerTable& get(int boxSize);
+
+    int get_box_size() const { return _BOX_SIZE; }
+    int get_board_size() const { return _BOARD_SIZE; }
+
+    int row_of(int cell) const { return _row[cell]; }
+    int col_of(int cell) const { return _col[cell]; }
+    int box_of(int cell) const { return _box[cell]; }
+
+    // Identificadores de unidad
+    int row_unit(int row) const { return row; }
+    int column_unit(int col) const { return _BOARD_SIZE + col; }
+    int box_unit(int box) const { return 2 * _BOARD_SIZE + box; }
+
+    // Celdas de una unidad
+    CellRange unit(int unit) const {
+        return { _unitCells + unit * _BOARD_SIZE, _unitCells + (unit + 1) * _BOARD_SIZE };
+    }
+
+    // Vecinos de una celda: todos, o solo los de su fila, su columna o el resto de su caja
+    CellRange peers(int cell) const {
+        const std::uint16_t* first = _peers + cell * _NUM_PEERS;
+        return { first, first + _NUM_PEERS };
+    }
+    CellRange row_peers(int cell) const {
+        const std::uint16_t* first = _peers + cell * _NUM_PEERS;
+        return { first, first + (_BOARD_SIZE - 1) };
+    }
+    CellRange column_peers(int cell) const {
+        const std::uint16_t* first = _peers + cell * _NUM_PEERS + (_BOARD_SIZE - 1);
+        return { first, first + (_BOARD_SIZE - 1) };
+    }
+    CellRange box_peers(int cell) const {
+        const std::uint16_t* first = _peers + cell * _NUM_PEERS;
+        return { first + 2 * (_BOARD_SIZE - 1), first + _NUM_PEERS };
+    }
+};
+
+#endif // PEERTABLE_HPP
@@ -0,0 +1,52 @@
+#ifndef PERFCOUNTERS_HPP
+#define PERFCOUNTERS_HPP
+
+#include "SudokuSolver.hpp"
+
+// Contadores hardware que se leen alrededor de cada resolución
+enum PERF_COUNTER {
+    CYCLES,          // Ciclos de CPU
+    INSTRUCTIONS,    // Instrucciones retiradas
+    CACHE_MISSES,    // Fallos de caché (según el evento genérico del núcleo)
+    BRANCH_MISSES,   // Saltos mal predichos
+    LLC_MISSES,      // Fallos de lectura en la caché de último nivel
+    NUM_PERF_COUNTERS
+};
+
+extern const char* PERF_COUNTER_NAMES[NUM_PERF_COUNTERS];
+
+// Lectura de los contadores de una medición. valid[i] es false si el contador no está disponible
+struct PerfSample {
+    long long value[NUM_PERF_COUNTERS] = {};
+    bool valid[NUM_PERF_COUNTERS] = {};
+};
+
+// Contadores hardware de Linux (perf_event_open) agrupados bajo el de ciclos, para que el núcleo los
+// programe a la vez. Se heredan a los hilos creados después de abrirlos, así que deben construirse antes
+// de la primera región paralela para contar también los hilos de OpenMP. Los contadores que el procesador o
+// el núcleo no ofrecen (máquinas virtuales, perf_event_paranoid) se marcan como no disponibles; fuera de
+// Linux ninguno lo está y start/stop no hacen nada.
+class PerfCounters {
+private:
+    int _fd[NUM_PERF_COUNTERS];    // Descriptor de cada evento (-1 si no se pudo abrir)
+
+public:
+    PerfCounters();
+    ~PerfCounters();
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    // true si se pudo abrir al menos un contador
+    bool is_available() const;
+    bool is_supported(PERF_COUNTER counter) const { return _fd[counter] >= 0; }
+
+    // Pone los contadores a cero y los activa / los detiene y devuelve su valor (escalado si el núcleo
+    // los ha multiplexado con otros eventos)
+    void start();
+    PerfSample stop();
+
+    // Resuelve con el solucionador y devuelve los contadores de la llamada a solve()
+    PerfSample measure_solve(SudokuSolver& solver);
+};
+
+#endif // PERFCOUNTERS_HPP
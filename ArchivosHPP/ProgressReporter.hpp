@@ -0,0 +1,37 @@
+#ifndef PROGRESSREPORTER_HPP
+#define PROGRESSREPORTER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Barra de progreso dibujada por un hilo aparte. El solucionador solo publica en un contador atómico (con
+// memory_order_relaxed, una escritura por nodo) cuántas celdas lleva rellenadas; el hilo lo muestrea cada
+// intervalo y redibuja la barra cuando se supera el máximo anterior. Así el kernel no recorre el tablero
+// ni espera a la consola. El hilo se detiene (y dibuja el estado final) al destruir el objeto.
+class ProgressReporter {
+private:
+    const std::atomic<int>& _progress;   // Celdas rellenadas en el nodo actual de la búsqueda
+    int _total;                          // Celdas vacías iniciales (100%)
+    std::chrono::milliseconds _interval; // Periodo de muestreo
+    int _shown = -1;                     // Máximo ya dibujado
+    bool _stop = false;
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::thread _thread;
+
+    void run();
+    void draw();
+
+public:
+    static const int DEFAULT_INTERVAL_MS = 100;
+
+    ProgressReporter(const std::atomic<int>& progress, int total, int interval_ms = DEFAULT_INTERVAL_MS);
+    ~ProgressReporter();
+    ProgressReporter(const ProgressReporter&) = delete;
+    ProgressReporter& operator=(const ProgressReporter&) = delete;
+};
+
+#endif // PROGRESSREPORTER_HPP
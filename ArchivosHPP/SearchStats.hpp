@@ -0,0 +1,106 @@
+#ifndef SEARCHSTATS_HPP
+#define SEARCHSTATS_HPP
+
+#include <algorithm>
+#include <vector>
+
+// Estadísticas del árbol de búsqueda. Se activan compilando con -DSUDOKU_SEARCH_STATS=1; por defecto la
+// especialización desactivada no tiene miembros y todas sus funciones están vacías, así que las llamadas
+// de los kernels desaparecen al compilar y no cuestan nada.
+#ifndef SUDOKU_SEARCH_STATS
+#define SUDOKU_SEARCH_STATS 0
+#endif
+
+template <bool ENABLED>
+class BasicSearchStats {
+private:
+    long long _nodes = 0;          // Nodos visitados
+    long long _backtracks = 0;     // Ramas deshechas sin encontrar solución
+    long long _eliminations = 0;   // Candidatos eliminados por propagación
+    int _max_depth = 0;            // Profundidad máxima alcanzada
+    std::vector<std::vector<long long>> _branching;   // [profundidad][factor de ramificación] -> nodos
+
+public:
+    static constexpr bool enabled = true;
+
+    // Nodo a la profundidad depth (número de decisiones tomadas desde la raíz)
+    void node(int depth) {
+        ++_nodes;
+        _max_depth = std::max(_max_depth, depth);
+    }
+
+    // Número de alternativas (candidatos o filas de cobertura) entre las que se ramifica el nodo
+    void branch(int depth, int factor) {
+        if ((int)_branching.size() <= depth) { _branching.resize(depth + 1); }
+        std::vector<long long>& histogram = _branching[depth];
+        if ((int)histogram.size() <= factor) { histogram.resize(factor + 1, 0); }
+        ++histogram[factor];
+    }
+
+    void backtrack() { ++_backtracks; }
+    void eliminate(long long count = 1) { _eliminations += count; }
+
+    // Acumula las estadísticas de otro solucionador o hilo
+    void merge(const BasicSearchStats& other) {
+        _nodes += other._nodes;
+        _backtracks += other._backtracks;
+        _eliminations += other._eliminations;
+        _max_depth = std::max(_max_depth, other._max_depth);
+        for (int depth = 0; depth < (int)other._branching.size(); ++depth) {
+            for (int factor = 0; factor < (int)other._branching[depth].size(); ++factor) {
+                if (other._branching[depth][factor] == 0) { continue; }
+                if ((int)_branching.size() <= depth) { _branching.resize(depth + 1); }
+                if ((int)_branching[depth].size() <= factor) { _branching[depth].resize(factor + 1, 0); }
+                _branching[depth][factor] += other._branching[depth][factor];
+            }
+        }
+    }
+
+    void clear() { *this = BasicSearchStats(); }
+
+    long long nodes() const { return _nodes; }
+    long long backtracks() const { return _backtracks; }
+    long long eliminations() const { return _eliminations; }
+    int max_depth() const { return _max_depth; }
+    const std::vector<std::vector<long long>>& branching() const { return _branching; }
+
+    // Factor de ramificación medio de los nodos que ramifican (sin contar los callejones sin salida, de factor 0)
+    double mean_branching() const {
+        long long count = 0, total = 0;
+        for (const std::vector<long long>& histogram : _branching) {
+            for (int factor = 1; factor < (int)histogram.size(); ++factor) {
+                count += histogram[factor];
+                total += histogram[factor] * factor;
+            }
+        }
+        return (count > 0) ? (double)total / count : 0.0;
+    }
+};
+
+// Versión desactivada: sin estado y sin trabajo
+template <>
+class BasicSearchStats<false> {
+public:
+    static constexpr bool enabled = false;
+
+    void node(int) {}
+    void branch(int, int) {}
+    void backtrack() {}
+    void eliminate(long long = 1) {}
+    void merge(const BasicSearchStats&) {}
+    void clear() {}
+
+    long long nodes() const { return 0; }
+    long long backtracks() const { return 0; }
+    long long eliminations() const { return 0; }
+    int max_depth() const { return 0; }
+    const std::vector<std::vector<long long>>& branching() const {
+        static const std::vector<std::vector<long long>> empty;
+        return empty;
+    }
+    double mean_branching() const { return 0.0; }
+};
+
+using SearchStats = BasicSearchStats<SUDOKU_SEARCH_STATS != 0>;
+
+#endif // SEARCHSTATS_HPP
@@ -0,0 +1,82 @@
+#ifndef SOLVEOPTIONS_HPP
+#define SOLVEOPTIONS_HPP
+
+#include "SearchStats.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+// Límites de una resolución. Los valores por defecto no limitan nada
+struct SolveOptions {
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();  // Hora límite
+    long long node_budget = 0;       // Nodos del árbol de búsqueda (0 = sin límite)
+    std::size_t memory_budget = 0;   // Bytes de memoria residente del proceso (0 = sin límite)
+
+    // Fija la hora límite a ms milisegundos desde ahora
+    void set_time_limit(long long ms) { deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(ms); }
+
+    bool is_limited() const {
+        return deadline != std::chrono::steady_clock::time_point::max() || node_budget > 0 || memory_budget > 0;
+    }
+};
+
+// Estado final de una resolución
+enum class SOLVE_STATUS {
+    RUNNING,                   // En curso (o no iniciada)
+    SOLVED,                    // Se encontró una solución
+    NO_SOLUTION,               // Se recorrió todo el árbol sin encontrar solución
+    TIMED_OUT,                 // Se alcanzó la hora límite
+    NODE_BUDGET_EXHAUSTED,     // Se agotó el presupuesto de nodos
+    MEMORY_BUDGET_EXHAUSTED    // La memoria residente superó el presupuesto
+};
+
+const char* to_string(SOLVE_STATUS status);
+
+// Resultado de SudokuSolver::solve_with_options, con las estadísticas parciales si se cortó la búsqueda
+struct SolveResult {
+    SOLVE_STATUS status = SOLVE_STATUS::RUNNING;
+    long long nodes = 0;        // Nodos visitados (contados por el presupuesto)
+    double elapsed_ms = 0.0;    // Tiempo de pared de la resolución
+    SearchStats stats;          // Estadísticas del árbol (vacías salvo con SUDOKU_SEARCH_STATS)
+};
+
+// Presupuesto compartido por los kernels (y los hilos) de una resolución. Cada nodo cuesta un incremento
+// atómico relajado y una comparación; el reloj y la memoria solo se consultan cada CHECK_INTERVAL nodos.
+// Una vez agotado, charge() devuelve true en todos los hilos hasta que se reinicie.
+class SolveBudget {
+private:
+    SolveOptions _options;
+    std::atomic<long long> _nodes{0};
+    std::atomic<int> _status{ static_cast<int>(SOLVE_STATUS::RUNNING) };
+
+    void stop(SOLVE_STATUS status);
+
+public:
+    static const long long CHECK_INTERVAL = 1024;   // Nodos entre consultas del reloj y de la memoria (potencia de 2)
+
+    // Reinicia el contador con nuevos límites
+    void reset(const SolveOptions& options);
+
+    // Cuenta un nodo; true si la búsqueda debe abandonarse
+    bool charge() {
+        if (_status.load(std::memory_order_relaxed) != static_cast<int>(SOLVE_STATUS::RUNNING)) { return true; }
+        long long nodes = _nodes.fetch_add(1, std::memory_order_relaxed) + 1;
+        if (_options.node_budget > 0 && nodes > _options.node_budget) {
+            stop(SOLVE_STATUS::NODE_BUDGET_EXHAUSTED);
+            return true;
+        }
+        return ((nodes & (CHECK_INTERVAL - 1)) == 0) && check_limits();
+    }
+
+    // Consulta el reloj y la memoria; true (y marca el estado) si se ha superado alguno
+    bool check_limits();
+
+    bool exhausted() const { return status() != SOLVE_STATUS::RUNNING; }
+    SOLVE_STATUS status() const { return static_cast<SOLVE_STATUS>(_status.load(std::memory_order_relaxed)); }
+    long long nodes() const { return _nodes.load(std::memory_order_relaxed); }
+};
+
+// Memoria residente del proceso en bytes (0 si no se puede consultar en esta plataforma)
+std::size_t current_memory_usage();
+
+#endif // SOLVEOPTIONS_HPP
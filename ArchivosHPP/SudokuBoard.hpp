@@ -6,83 +6,135 @@
 #include <iostream> 
 #include <variant>  
 #include <set>      
+#include <cstdint>
 
 // Definir alias para los tipos de datos usados en el tablero y matrices de cobertura y estado
-using Board = std::vector<std::vector<int>>;            // Tamaño: _BOARD_SIZE * _BOARD_SIZE
-using CoverMatrix = std::vector<std::vector<int>>;      // Tamaño: (_BOARD_SIZE * _BOARD_SIZE * _MAX_VALUE) * (_BOARD_SIZE * _BOARD_SIZE * _NUM_CONSTRAINTS)
+using Board = std::vector<std::vector<int>>;            // Tamaño: _BOARD_SIZE * _BOARD_SIZE (solo para entrada/salida)
 using MultiType = std::variant<int, std::set<int>>;     // Puede ser un int o un set de int
 using StateMatrix = std::vector<std::vector<MultiType>>;// Tamaño: _BOARD_SIZE * _BOARD_SIZE
 
+// Tablero de Sudoku como tipo valor compacto: las celdas van fila a fila en un único bloque contiguo de 16 bits
+// y el tamaño ocupa unos pocos bytes. Junto a las celdas se mantienen, en cada escritura, el número de celdas
+// vacías y una máscara de los números usados en cada fila, columna y caja, así que "¿cabe num aquí?", "¿está
+// lleno?" y "¿cuántas vacías quedan?" no recorren el tablero. Las máscaras usan palabras de 16 bits y van en el
+// mismo bloque, detrás de las celdas: copiar un tablero es una reserva y un memcpy (216 bytes en 9x9) y moverlo
+// no copia nada.
 class SudokuBoard {
     friend class SudokuSolver; // Permitir acceso a la clase SudokuSolver
     friend class SudokuTest;   // Permitir acceso a la clase SudokuTest
 
+public:
+    using Cell = std::uint16_t;   // Valor de una celda
+    using Mask = std::uint16_t;   // Palabra de las máscaras de ocupación (del mismo tipo que las celdas)
+
 private:
-    Board _board_data;    // Datos del tablero
-    int _BOX_SIZE;        // Tamaño de la caja (subgrilla)
-    int _BOARD_SIZE;      // Tamaño del tablero
-    int _MIN_VALUE = 1;   // Valor mínimo permitido en el tablero
-    int _MAX_VALUE = _BOARD_SIZE; // Valor máximo permitido en el tablero
-    int _NUM_CONSTRAINTS = 4;     // 4 restricciones: celda, fila, columna, caja
-    int _INIT_NUM_EMPTY_CELLS;    // Número inicial de celdas vacías
-    int _EMPTY_CELL_VALUE = 0;    // Valor de celda vacía
-    std::string _EMPTY_CELL_CHARACTER = ".";  // Caracter de celda vacía
-    int _COVER_MATRIX_START_INDEX = 1;        // Índice de inicio para la matriz de cobertura
+    // Celdas del tablero fila a fila (_BOARD_SIZE * _BOARD_SIZE) seguidas de los números usados por unidad:
+    // filas, columnas y cajas, _maskWords palabras cada una
+    std::vector<Cell> _cells;
+    std::uint16_t _BOARD_SIZE = 0;        // Tamaño del tablero (también es el valor máximo)
+    std::uint8_t _BOX_SIZE = 0;           // Tamaño de la caja (subgrilla)
+    std::uint8_t _maskWords = 0;          // Palabras de 16 bits por máscara
+    bool _repeated = false;               // true si algún número se ha repetido en una unidad (pistas inválidas)
+    int _numEmpty = 0;                    // Número actual de celdas vacías
+    int _INIT_NUM_EMPTY_CELLS = 0;        // Número inicial de celdas vacías
+
+    static constexpr int _MIN_VALUE = 1;                // Valor mínimo permitido en el tablero
+    static constexpr int _EMPTY_CELL_VALUE = 0;         // Valor de celda vacía
+    static constexpr const char* _EMPTY_CELL_CHARACTER = ".";   // Caracter de celda vacía
+
+    static constexpr int _MASK_BITS = 16;               // Bits por palabra de máscara
+
+    // Índices de las máscaras de la fila, la columna y la caja de una celda (la palabra del número num)
+    int row_mask(int row, int num) const { return row * _maskWords + (num - 1) / _MASK_BITS; }
+    int col_mask(int col, int num) const { return (_BOARD_SIZE + col) * _maskWords + (num - 1) / _MASK_BITS; }
+    int box_mask(int row, int col, int num) const {
+        int box = (row / _BOX_SIZE) * ((_BOARD_SIZE + _BOX_SIZE - 1) / _BOX_SIZE) + col / _BOX_SIZE;
+        return (2 * _BOARD_SIZE + box) * _maskWords + (num - 1) / _MASK_BITS;
+    }
+    static Mask bit_of(int num) { return Mask(1u << ((num - 1) % _MASK_BITS)); }
+    // Palabra index de las máscaras, detrás de las celdas
+    Mask& mask(int index) { return _cells[_BOARD_SIZE * _BOARD_SIZE + index]; }
+    Mask mask(int index) const { return _cells[_BOARD_SIZE * _BOARD_SIZE + index]; }
+    int num_mask_words() const;               // Palabras de máscara de todas las unidades
+    bool in_range(int num) const { return num >= _MIN_VALUE && num <= _BOARD_SIZE; }
+
+    void rebuild_occupancy();                 // Recalcula las máscaras y las vacías a partir de las celdas
+    void add_value(int cell, int num);        // Marca num en las unidades de la celda
+    void erase_value(int cell, int num);      // Desmarca num (o recalcula sus unidades si hay repetidos)
+    bool peer_holds(int row, int col, int num) const;   // Búsqueda directa de num entre los vecinos de la celda
 
 public:
-    // Devuelve un vector 2D leyendo de un archivo que contiene el tablero de Sudoku inicial en formato separado por espacios
+    // Carga el tablero desde un archivo que contiene el tablero de Sudoku inicial en formato separado por espacios
     // (las celdas vacías están representadas por 0)
-    const Board read_input(const std::string& filename);
+    void read_input(const std::string& filename);
     
     // Escribe la solución en un archivo de texto (solution.txt)
     friend void write_output(const SudokuBoard& solutionBoard);
+
+    // Escribe el tablero en el mismo formato que lee read_input (tamaño seguido de las celdas)
+    friend void write_input(const SudokuBoard& board, const std::string& filename);
     
     SudokuBoard() = default;   // Constructor por defecto
-    SudokuBoard(const std::string& filename);  // Constructor que inicializa desde un archivo
-    SudokuBoard(const SudokuBoard& anotherSudokuBoard);  // Constructor de copia
+    SudokuBoard(const std::string& filename, bool print_message=true);  // Constructor que inicializa desde un archivo
+    SudokuBoard(const Board& board_data);      // Constructor que inicializa desde datos en memoria (0 = vacía)
+
+    // Copia y movimiento por defecto: el bloque de celdas y máscaras se copia de una vez o se transfiere
+    SudokuBoard(const SudokuBoard&) = default;
+    SudokuBoard(SudokuBoard&&) noexcept = default;
+    SudokuBoard& operator= (const SudokuBoard&) = default;
+    SudokuBoard& operator= (SudokuBoard&&) noexcept = default;
 
     // Funciones para establecer y obtener los datos del tablero
-    void set_board_data(int row, int col, int num) { _board_data[row][col] = num; }
-    int get_board_data(int row, int col) const { return _board_data[row][col]; }
-    Board get_board_data() const { return _board_data; }
-    int at(int row, int col) const { return _board_data[row][col]; }
+    void set_board_data(int row, int col, int num) { set_cell(row * _BOARD_SIZE + col, num); }
+    int get_board_data(int row, int col) const { return _cells[row * _BOARD_SIZE + col]; }
+    Board get_board_data() const;   // Copia del tablero en forma de filas
+    int at(int row, int col) const { return _cells[row * _BOARD_SIZE + col]; }
+
+    // Acceso por índice de celda (fila * tamaño + columna) y al bloque contiguo de celdas
+    int at(int cell) const { return _cells[cell]; }
+    void set_cell(int cell, int num) {
+        int old = _cells[cell];
+        if (old == num) { return; }
+        _cells[cell] = (Cell)num;
+        if (old == _EMPTY_CELL_VALUE) { --_numEmpty; } else { erase_value(cell, old); }
+        if (num == _EMPTY_CELL_VALUE) { ++_numEmpty; } else { add_value(cell, num); }
+    }
+    const Cell* data() const { return _cells.data(); }
+
+    // Consultas de ocupación en O(1): si num ya está en la fila, la columna o la caja
+    bool row_contains(int row, int num) const { return in_range(num) && (mask(row_mask(row, num)) & bit_of(num)); }
+    bool col_contains(int col, int num) const { return in_range(num) && (mask(col_mask(col, num)) & bit_of(num)); }
+    bool box_contains(int row, int col, int num) const { return in_range(num) && (mask(box_mask(row, col, num)) & bit_of(num)); }
+
+    // true si ninguna otra celda de la fila, la columna o la caja contiene num
+    bool can_place(int row, int col, int num) const {
+        if (at(row, col) == num) { return !_repeated || !peer_holds(row, col, num); }   // La propia celda no cuenta
+        return !row_contains(row, num) && !col_contains(col, num) && !box_contains(row, col, num);
+    }
+    bool has_repeated_values() const { return _repeated; }
+    bool is_full() const { return _numEmpty == 0; }
     
     // Funciones para obtener las dimensiones y otros valores del tablero
     int get_box_size() const { return _BOX_SIZE; }
     int get_board_size() const { return _BOARD_SIZE; }
     int get_min_value() const { return _MIN_VALUE; }
-    int get_max_value() const { return _MAX_VALUE; }
+    int get_max_value() const { return _BOARD_SIZE; }
     int get_init_num_empty_cells() const { return _INIT_NUM_EMPTY_CELLS; }
     int get_empty_cell_value() const { return _EMPTY_CELL_VALUE; }
     std::string get_empty_cell_character() const { return _EMPTY_CELL_CHARACTER; }
     
     int get_num_total_cells() const;
-    int get_num_empty_cells() const;
+    int get_num_empty_cells() const { return _numEmpty; }
     
     std::vector<int> getNumbersInRow(int indexOfRows) const;
     std::vector<int> getNumbersInCol(int indexOfColumns) const;
 
-    // Operador de asignación de copia
-    SudokuBoard& operator= (const SudokuBoard& another_sudokuboard);
-
     // Imprime el tablero de Sudoku de entrada
     friend std::ostream& operator<< (std::ostream &out, const SudokuBoard& board);
 
     // Imprime el tablero de Sudoku de salida
     friend void print_board(const SudokuBoard& board);
 
-    // Transforma el problema de Sudoku en una instancia del problema de cobertura exacta, es decir,
-    // modela una cuadrícula de Sudoku en forma de matriz de cobertura con tamaño:
-    // (_BOARD_SIZE * _BOARD_SIZE * _MAX_VALUE) * (BOARD_SIZE * _BOARD_SIZE * _NUM_CONSTRAINTS)
-    int indexInCoverMatrix(int row, int col, int num);
-    int createBoxConstraints(CoverMatrix& coverMatrix, int header);
-    int createColumnConstraints(CoverMatrix& coverMatrix, int header);
-    int createRowConstraints(CoverMatrix& coverMatrix, int header);
-    int createCellConstraints(CoverMatrix& coverMatrix, int header);
-    
-    void createCoverMatrix(CoverMatrix& coverMatrix);
-    void convertToCoverMatrix(CoverMatrix& coverMatrix);
-
     // Agrega información de estado al tablero de Sudoku
     // reemplazando la celda vacía, es decir, 0, con un conjunto de valores posibles
     void createStateMatrix(StateMatrix& stateMatrix);
@@ -0,0 +1,49 @@
+#ifndef SUDOKUGENERATOR_HPP
+#define SUDOKUGENERATOR_HPP
+
+#include "SudokuBoard.hpp"
+#include <vector>
+#include <random>
+
+// Simetría con la que se quitan las pistas (cada grupo de celdas simétricas se quita a la vez)
+enum class SYMMETRY {
+    NONE,         // Sin simetría: las pistas se quitan de una en una en orden aleatorio
+    ROTATIONAL,   // Simetría de rotación de 180 grados
+    MIRROR,       // Simetría respecto al eje vertical central
+    DIAGONAL      // Simetría respecto a la diagonal principal
+};
+
+// Opciones del generador
+struct GeneratorOptions {
+    int box_size = 3;                     // Tamaño de la caja: 3 -> 9x9, 4 -> 16x16, 5 -> 25x25
+    int target_clues = 0;                 // Pistas objetivo (0 = quitar todas las que se puedan)
+    SYMMETRY symmetry = SYMMETRY::NONE;   // Simetría de las pistas
+    unsigned seed = 0;                    // Semilla base: el sudoku i de un lote usa seed + i
+};
+
+// Generador de sudokus con solución única.
+// Crea una cuadrícula completa aleatoria (relleno aleatorio con el backtracking de máscaras de bits, propagando
+// singles y volviendo a empezar si un intento se alarga) y
+// quita pistas en orden aleatorio, comprobando después de cada eliminación que la solución sigue siendo única.
+class SudokuGenerator {
+private:
+    GeneratorOptions _options;
+
+public:
+    SudokuGenerator(const GeneratorOptions& options);
+
+    // Devuelve una cuadrícula completa y válida elegida al azar
+    static Board random_full_grid(int box_size, std::mt19937& rng);
+
+    // Genera un sudoku con solución única
+    SudokuBoard generate(std::mt19937& rng) const;
+
+    // Genera count sudokus en paralelo (num_threads = 0 usa el número de hilos por defecto de OpenMP).
+    // El resultado es reproducible: no depende del número de hilos.
+    std::vector<SudokuBoard> generate_batch(int count, int num_threads = 0) const;
+
+    // Celdas que forman el grupo simétrico de cell (incluida ella misma)
+    std::vector<int> symmetric_group(int cell) const;
+};
+
+#endif // SUDOKUGENERATOR_HPP
@@ -0,0 +1,75 @@
+#ifndef SUDOKUGRADER_HPP
+#define SUDOKUGRADER_HPP
+
+#include "SudokuBoard.hpp"
+#include "PeerTable.hpp"
+#include <vector>
+#include <string>
+#include <cstdint>
+
+// Escalera de técnicas humanas, ordenadas de la más fácil a la más difícil
+enum class TECHNIQUE {
+    NAKED_SINGLE,        // Celda con un único candidato
+    HIDDEN_SINGLE,       // Número con una única celda posible en una unidad
+    LOCKED_CANDIDATES,   // Candidatos de una caja alineados en una fila/columna (y viceversa)
+    NAKED_PAIR,          // Dos celdas de una unidad con los mismos dos candidatos
+    HIDDEN_PAIR,         // Dos números que solo caben en las mismas dos celdas de una unidad
+    NAKED_TRIPLE,        // Tres celdas de una unidad con tres candidatos en total
+    X_WING,              // Un número en dos filas (o columnas) restringido a las mismas dos columnas (o filas)
+    SEARCH               // Las técnicas no bastan: hace falta probar y retroceder
+};
+const int NUM_TECHNIQUES = 8;
+
+// Nombre legible de una técnica
+std::string to_string(TECHNIQUE technique);
+
+// Resultado de calificar un sudoku
+struct GradeReport {
+    TECHNIQUE hardest = TECHNIQUE::NAKED_SINGLE;  // Técnica más difícil necesaria
+    int uses[NUM_TECHNIQUES] = { };               // Veces que se aplicó cada técnica
+    bool contradiction = false;                   // Las técnicas encontraron una contradicción (sin solución)
+    int num_solutions = 0;                        // Soluciones del solucionador de referencia (hasta 2)
+    long long search_nodes = 0;                   // Nodos visitados por el solucionador de referencia
+    long long search_backtracks = 0;              // Retrocesos del solucionador de referencia
+
+    // Categoría para elegir modo de resolución y nivel de servicio: "easy", "medium", "hard" o "expert"
+    std::string difficulty() const;
+};
+
+// Calificador de dificultad.
+// Resuelve con la escalera de técnicas (siempre la más fácil que avance) e informa de la más difícil necesaria;
+// si una técnica descubre una contradicción se detiene ahí, sin recurrir a la búsqueda.
+// Si se pide, añade el esfuerzo de búsqueda (nodos y retrocesos) del backtracking MRV con máscaras de bits.
+class SudokuGrader {
+private:
+    using Mask = std::uint64_t;
+
+    int _BOARD_SIZE;                         // Tamaño del tablero
+    int _BOX_SIZE;                           // Tamaño de la caja (subgrilla)
+    std::vector<int> _values;                // Valor de cada celda (0 = vacía)
+    std::vector<Mask> _candidates;           // Candidatos de cada celda vacía
+    const PeerTable* _table = nullptr;       // Unidades y vecinos de cada celda: filas, luego columnas, luego cajas
+    bool _contradiction = false;
+    int _numEmpty = 0;                       // Celdas vacías que quedan (assign lo actualiza)
+
+    void assign(int cell, int num);          // Coloca un número y lo elimina de los candidatos de sus vecinas
+    bool eliminate(int cell, Mask mask);     // Quita candidatos; devuelve true si cambió algo
+
+    bool apply(TECHNIQUE technique);         // Aplica una técnica una vez; devuelve true si avanzó
+    bool naked_single();
+    bool hidden_single();
+    bool locked_candidates();
+    bool naked_pair();
+    bool hidden_pair();
+    bool naked_triple();
+    bool x_wing();
+
+public:
+    static const long long SEARCH_NODE_LIMIT = 1000000;   // Tope de nodos del solucionador de referencia
+
+    // Califica el sudoku con la escalera de técnicas. measure_search = true ejecuta además el solucionador de
+    // referencia (hasta SEARCH_NODE_LIMIT nodos) para rellenar num_solutions, search_nodes y search_backtracks
+    GradeReport grade(const SudokuBoard& board, bool measure_search = false);
+};
+
+#endif // SUDOKUGRADER_HPP
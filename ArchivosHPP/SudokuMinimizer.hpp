@@ -0,0 +1,27 @@
+#ifndef SUDOKUMINIMIZER_HPP
+#define SUDOKUMINIMIZER_HPP
+
+#include "SudokuBoard.hpp"
+
+// Reduce un sudoku con solución única a un sudoku mínimo: quitar cualquiera de las pistas restantes
+// haría que la solución dejara de ser única.
+//
+// Las comprobaciones de unicidad de cada pista candidata son independientes, así que se evalúan por lotes
+// en paralelo (OpenMP). Las pistas que pasan la comprobación se quitan juntas de forma especulativa; si el
+// tablero resultante ya no es único se deshace el lote y solo se quita la primera, devolviendo las demás a
+// la cola. Una pista que no se puede quitar tampoco se podrá quitar más adelante (con menos pistas solo hay
+// más soluciones), así que se marca como imprescindible sin volver a comprobarla.
+class SudokuMinimizer {
+private:
+    int _num_threads;   // Hilos para las comprobaciones (0 = número por defecto de OpenMP)
+    int _batch_size;    // Pistas candidatas por lote (0 = dos por hilo)
+
+public:
+    SudokuMinimizer(int num_threads = 0, int batch_size = 0);
+
+    // Escribe en minimal el sudoku mínimo obtenido a partir de puzzle. El orden en que se prueban las pistas
+    // se baraja con seed. Devuelve false (sin tocar minimal) si puzzle no es válido o no tiene solución única.
+    bool minimize(const SudokuBoard& puzzle, SudokuBoard& minimal, unsigned seed = 0) const;
+};
+
+#endif // SUDOKUMINIMIZER_HPP
@@ -0,0 +1,42 @@
+#ifndef SUDOKUPARALLELPROFILE_HPP
+#define SUDOKUPARALLELPROFILE_HPP
+
+#include "SudokuSolver.hpp"
+#include <map>
+#include <string>
+#include <utility>
+
+// Parámetros de reparto de los solucionadores paralelos
+struct ParallelConfig {
+    int num_threads = 0;     // Hilos (0 = número de hilos por defecto de OpenMP)
+    int split_depth = 1;     // DLX paralelo: niveles del árbol que se expanden antes de repartir los subárboles
+    int kernel = 1;          // Fuerza bruta paralela: 1 = frontera BFS, 2 = por filas, 3 = tareas recursivas
+    int frontier_size = 0;   // Fuerza bruta paralela (kernel 1): tableros de la frontera (0 = 4 por hilo)
+    int task_cutoff = 2;     // Fuerza bruta paralela (kernel 3): celdas rellenadas a partir de las cuales no se crean tareas
+};
+
+// Perfil de parámetros paralelos por modo y tamaño de tablero, escrito por la herramienta Autotune y
+// leído por los solucionadores paralelos al construirse. Formato de texto, una configuración por línea:
+//     <MODO> <tamaño> <hilos> <split_depth> <kernel> <frontier_size> <task_cutoff>
+class ParallelProfile {
+private:
+    std::map<std::pair<MODES, int>, ParallelConfig> _configs;   // Configuración por (modo, tamaño)
+
+public:
+    // Configuración para un modo y tamaño: la del perfil si existe, si no la configuración por defecto
+    ParallelConfig lookup(MODES mode, int board_size) const;
+
+    void set(MODES mode, int board_size, const ParallelConfig& config) { _configs[{ mode, board_size }] = config; }
+
+    // Lee/escribe el perfil. load devuelve false si el archivo no existe o tiene una línea inválida
+    bool load(const std::string& filename);
+    bool save(const std::string& filename) const;
+
+    // Archivo del perfil: variable de entorno SUDOKU_PARALLEL_PROFILE o "parallel_profile.txt"
+    static std::string default_file_name();
+
+    // Perfil cargado de default_file_name() la primera vez que se pide (vacío si no existe el archivo)
+    static const ParallelProfile& get();
+};
+
+#endif // SUDOKUPARALLELPROFILE_HPP
@@ -0,0 +1,170 @@
+#ifndef SUDOKUSOLUTIONENUMERATOR_HPP
+#define SUDOKUSOLUTIONENUMERATOR_HPP
+
+#include "SudokuBoard.hpp"
+#include "DLXTemplate.hpp"
+#include "BitBoard.hpp"
+#include <vector>
+#include <string>
+#include <iterator>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <chrono>
+
+// Versión del formato de los puntos de control
+#define CHECKPOINT_VERSION 1
+// Iteraciones de la búsqueda entre dos consultas del reloj para el guardado periódico
+#define CHECKPOINT_CHECK_INTERVAL 4096
+
+// Guardado periódico de la búsqueda en un archivo de punto de control. Lo comparten los enumeradores:
+// cada CHECKPOINT_CHECK_INTERVAL iteraciones se consulta el reloj y, si ha pasado el intervalo, toca guardar.
+class CheckpointSchedule {
+private:
+    std::string _filename;                                // Archivo de destino ("" = desactivado)
+    std::chrono::milliseconds _interval{ 0 };             // Tiempo entre dos guardados
+    std::chrono::steady_clock::time_point _last;          // Último guardado (o activación)
+    int _iterations = 0;                                  // Iteraciones desde la última consulta del reloj
+
+public:
+    void set(const std::string& filename, int interval_ms) {
+        _filename = filename;
+        _interval = std::chrono::milliseconds(interval_ms);
+        _last = std::chrono::steady_clock::now();
+        _iterations = 0;
+    }
+    const std::string& filename() const { return _filename; }
+
+    // true si hay que guardar ahora; se llama una vez por iteración de la búsqueda
+    bool due() {
+        if (_filename.empty() || ++_iterations < CHECKPOINT_CHECK_INTERVAL) { return false; }
+        _iterations = 0;
+        auto now = std::chrono::steady_clock::now();
+        if (now - _last < _interval) { return false; }
+        _last = now;
+        return true;
+    }
+};
+
+// Iterador de entrada para recorrer un enumerador con un bucle for de rango:
+//     for (const SudokuBoard& solution : enumerator) { ... }
+// Cada incremento llama a next(), así que salir del bucle antes de tiempo no hace trabajo de más.
+template <typename Enumerator>
+class SolutionIterator {
+private:
+    Enumerator* _enumerator;   // nullptr representa el final
+
+public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = SudokuBoard;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const SudokuBoard*;
+    using reference = const SudokuBoard&;
+
+    explicit SolutionIterator(Enumerator* enumerator) : _enumerator(enumerator) {
+        if (_enumerator != nullptr && !_enumerator->next()) { _enumerator = nullptr; }
+    }
+    reference operator* () const { return _enumerator->solution(); }
+    pointer operator-> () const { return &_enumerator->solution(); }
+    SolutionIterator& operator++ () {
+        if (!_enumerator->next()) { _enumerator = nullptr; }
+        return *this;
+    }
+    bool operator== (const SolutionIterator& other) const { return _enumerator == other._enumerator; }
+    bool operator!= (const SolutionIterator& other) const { return _enumerator != other._enumerator; }
+};
+
+// Enumera perezosamente todas las soluciones con el Algoritmo X sobre una copia de la plantilla DLX.
+// La búsqueda guarda su estado en una pila explícita (columna y fila elegidas en cada nivel), así que
+// next() se suspende en cada solución y continúa exactamente donde se quedó (la pila se avanza y se deshace con
+// las operaciones de SudokuSolver_SequentialDLX). La memoria es constante:
+// la pila nunca supera el número de celdas vacías.
+// La pila también se puede guardar en un punto de control (los nodos de la plantilla son los mismos en cada
+// ejecución) y retomar más tarde: load_checkpoint repite las filas elegidas y la búsqueda sigue en el mismo nodo.
+class DLXSolutionEnumerator {
+private:
+    SudokuBoard _board;            // Tablero de partida, para validar los puntos de control
+    SudokuBoard _solution;         // Última solución encontrada (las pistas ya están escritas)
+    DLXInstance _dlx;              // Copia privada de la lista con las pistas cubiertas
+    std::vector<int> _columns;     // Columna cubierta en cada nivel
+    std::vector<int> _rows;        // Fila elegida en cada nivel
+    bool _started = false;         // Se ha llamado a next() al menos una vez
+    bool _finished = false;        // No quedan más soluciones
+    long long _numSolutions = 0;   // Soluciones devueltas hasta ahora
+    CheckpointSchedule _checkpoint; // Guardado periódico durante next()
+
+    // Escribe el estado; backtrackFirst indica si al retomar hay que pasar antes a la siguiente rama
+    bool write_checkpoint(const std::string& filename, bool backtrackFirst) const;
+
+public:
+    DLXSolutionEnumerator(const SudokuBoard& board);
+
+    // Avanza hasta la siguiente solución; devuelve false cuando ya no quedan
+    bool next();
+
+    // Guarda el estado de la búsqueda entre dos llamadas a next()
+    bool save_checkpoint(const std::string& filename) const { return write_checkpoint(filename, _started); }
+    // Retoma la búsqueda guardada; solo sobre un enumerador recién construido con el mismo tablero.
+    // Devuelve false (y deja el enumerador intacto) si el archivo no existe o no corresponde al tablero
+    bool load_checkpoint(const std::string& filename);
+    // Guarda automáticamente el estado cada interval_ms milisegundos mientras next() busca
+    void set_checkpoint(const std::string& filename, int interval_ms) { _checkpoint.set(filename, interval_ms); }
+
+    const SudokuBoard& solution() const { return _solution; }
+    long long get_num_solutions() const { return _numSolutions; }
+
+    SolutionIterator<DLXSolutionEnumerator> begin() { return SolutionIterator<DLXSolutionEnumerator>(this); }
+    SolutionIterator<DLXSolutionEnumerator> end() { return SolutionIterator<DLXSolutionEnumerator>(nullptr); }
+};
+
+// Enumera perezosamente todas las soluciones con el backtracking sobre máscaras de bits.
+// Cada nivel de la pila guarda la celda, el número colocado y los candidatos que quedan por probar; con
+// esos tres valores por nivel se guarda y se retoma el punto de control.
+// El tablero de bits es el del tamaño de caja del puzle (véase make_bitboard): cada operación se despacha una
+// vez con std::visit y el recorrido dentro de ella usa la versión fija.
+class BitBoardSolutionEnumerator {
+private:
+    struct ChoicePoint {
+        int cell;                  // Celda elegida (MRV)
+        int num;                   // Número colocado actualmente
+        std::uint64_t remaining;   // Candidatos que quedan por probar
+    };
+
+    SudokuBoard _board;            // Tablero de partida, para validar los puntos de control
+    SudokuBoard _solution;         // Última solución encontrada
+    AnyBitBoard _bitboard;         // Tablero de bits sobre el que se busca
+    std::vector<ChoicePoint> _stack; // Pila de puntos de elección
+    bool _started = false;
+    bool _finished = false;
+    long long _numSolutions = 0;
+    CheckpointSchedule _checkpoint; // Guardado periódico durante next()
+
+    // Prueba el siguiente candidato del nivel más profundo que lo tenga
+    template <class Bitboard> bool backtrack(Bitboard& bitboard);
+    // Deshace toda la pila y deja el tablero como tras el constructor
+    template <class Bitboard> void unwind(Bitboard& bitboard);
+    // Bucle de next() sobre la versión concreta del tablero
+    template <class Bitboard> bool search(Bitboard& bitboard);
+    // Repite depth puntos de elección leídos del archivo; false (sin cambios) si no encajan en el tablero
+    template <class Bitboard> bool replay(Bitboard& bitboard, std::istream& file, int depth);
+    bool write_checkpoint(const std::string& filename, bool backtrackFirst) const;
+
+public:
+    BitBoardSolutionEnumerator(const SudokuBoard& board);
+
+    // Avanza hasta la siguiente solución; devuelve false cuando ya no quedan
+    bool next();
+
+    // Igual que en DLXSolutionEnumerator
+    bool save_checkpoint(const std::string& filename) const { return write_checkpoint(filename, _started); }
+    bool load_checkpoint(const std::string& filename);
+    void set_checkpoint(const std::string& filename, int interval_ms) { _checkpoint.set(filename, interval_ms); }
+
+    const SudokuBoard& solution() const { return _solution; }
+    long long get_num_solutions() const { return _numSolutions; }
+
+    SolutionIterator<BitBoardSolutionEnumerator> begin() { return SolutionIterator<BitBoardSolutionEnumerator>(this); }
+    SolutionIterator<BitBoardSolutionEnumerator> end() { return SolutionIterator<BitBoardSolutionEnumerator>(nullptr); }
+};
+
+#endif // SUDOKUSOLUTIONENUMERATOR_HPP
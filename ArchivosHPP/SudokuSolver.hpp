@@ -2,6 +2,12 @@
 #define SUDOKUSOLVER_HPP
 
 #include "SudokuBoard.hpp"   
+#include "SearchStats.hpp"
+#include "ProgressReporter.hpp"
+#include "SolveOptions.hpp"
+#include "PeerTable.hpp"
+#include <atomic>
+#include <memory>
 #include <utility>           
 using Position = std::pair<int, int>;   // Definir alias para la posición como un par de enteros
 
@@ -12,7 +18,9 @@ enum class MODES {
     PARALLEL_BRUTEFORCE,        // Modo paralelo (OpenMP) usando algoritmo de fuerza bruta
     SEQUENTIAL_DANCINGLINKS,    // Modo secuencial usando algoritmo de "dancing links"
     PARALLEL_DANCINGLINKS,      // Modo paralelo (OpenMP) usando algoritmo de "dancing links"
-    SEQUENTIAL_FORWARDCHECKING  // Modo secuencial usando algoritmo de forward checking
+    SEQUENTIAL_FORWARDCHECKING, // Modo secuencial usando algoritmo de forward checking
+    SEQUENTIAL_BITBOARD,        // Modo secuencial usando backtracking con máscaras de bits
+    AUTO                        // Elige el modo según las características del tablero (tabla de despacho)
 };
 
 // Clase base SudokuSolver para resolver Sudokus
@@ -21,9 +29,29 @@ protected:
     SudokuBoard _board;               // Tablero de Sudoku a resolver
     bool _solved = false;             // Indicador de si el Sudoku ha sido resuelto
     SudokuBoard _solution;            // Solución del Sudoku
-    int _recursionDepth = 0;          // Profundidad de la recursión
-    int _current_num_empty_cells;     // Número actual de celdas vacías
     MODES _mode;                      // Modo de solución
+    bool _show_progress = true;       // Muestra la barra de progreso (false cuando no se imprimen mensajes)
+    SearchStats _stats;               // Estadísticas del árbol de búsqueda (vacías salvo con SUDOKU_SEARCH_STATS)
+    std::atomic<int> _progress{0};    // Celdas rellenadas en el nodo actual (lo muestrea el hilo de la barra de progreso)
+
+    // Publica el progreso de la búsqueda: una escritura relajada, sin recorrer el tablero ni esperar
+    void publish_progress(int depth) { _progress.store(depth, std::memory_order_relaxed); }
+
+    // Arranca el hilo de la barra de progreso si _show_progress; se detiene al destruir el puntero devuelto
+    std::unique_ptr<ProgressReporter> start_progress_reporter();
+
+    SolveBudget _own_budget;          // Presupuesto de solve_with_options
+    SolveBudget* _budget = nullptr;   // Presupuesto activo (nullptr = sin límites; puede ser el de otro solucionador)
+
+    // Cuenta un nodo contra el presupuesto; true si la búsqueda debe abandonarse. Sin límites es una comparación
+    bool out_of_budget() { return _budget != nullptr && _budget->charge(); }
+
+    const PeerTable* _peerTable;      // Unidades y vecinos de cada celda para el tamaño de _board
+
+    // Tablas para el tamaño de board (las de _board salvo que se pase un tablero de otro tamaño)
+    const PeerTable& peer_table(const SudokuBoard& board) const {
+        return (board.get_box_size() == _peerTable->get_box_size()) ? *_peerTable : PeerTable::get(board.get_box_size());
+    }
 
 public:
     SudokuSolver(SudokuBoard& board); // Constructor
@@ -62,6 +90,13 @@ public:
     // Función virtual pura para resolver el Sudoku (debe ser implementada por las clases derivadas)
     virtual void solve() = 0;
 
+    // Resuelve con hora límite y presupuestos de nodos y memoria. Si se alcanza un límite la búsqueda se abandona
+    // y el estado lo indica; nodes y stats reflejan lo explorado hasta entonces
+    SolveResult solve_with_options(const SolveOptions& options);
+
+    // Comparte el presupuesto de otro solucionador (los subsolucionadores de los modos paralelos)
+    void use_budget(SolveBudget* budget) { _budget = budget; }
+
     // Configura el modo de solución
     void set_mode(MODES mode) { _mode = mode; }
 
@@ -71,8 +106,8 @@ public:
     // Obtiene la solución del Sudoku
     SudokuBoard get_solution() const { return _solution; }
 
-    // Muestra una barra de progreso
-    void show_progress_bar(SudokuBoard& board, int recursionDepth, int interval=5);
+    // Obtiene las estadísticas de búsqueda de la última resolución
+    const SearchStats& get_stats() const { return _stats; }
 
     // Destructor virtual por defecto
     virtual ~SudokuSolver() = default;
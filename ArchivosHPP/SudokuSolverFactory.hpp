@@ -0,0 +1,90 @@
+#ifndef SUDOKUSOLVERFACTORY_HPP
+#define SUDOKUSOLVERFACTORY_HPP
+
+#include "SudokuBoard.hpp"
+#include "SudokuSolver.hpp"
+#include <memory>
+#include <string>
+#include <map>
+#include <vector>
+
+// Resultado de propagar los singles desnudos antes de buscar
+enum class PROPAGATION {
+    SOLVED,          // La propagación completa el tablero
+    STUCK,           // Quedan celdas vacías sin candidato forzado
+    CONTRADICTION    // Alguna celda se queda sin candidatos (o las pistas se contradicen)
+};
+
+// Características baratas de un sudoku para elegir el solucionador
+struct PuzzleFeatures {
+    int board_size = 0;                            // Tamaño del tablero
+    int num_clues = 0;                             // Número de pistas
+    double clue_ratio = 0.0;                       // Pistas / celdas
+    double candidate_density = 0.0;                // Candidatos medios por celda vacía, dividido por el tamaño
+    PROPAGATION propagation = PROPAGATION::STUCK;  // Resultado de la propagación de singles desnudos
+    double empty_after_propagation = 0.0;          // Fracción de celdas vacías tras la propagación
+};
+
+// Calcula las características de un sudoku (una pasada por las celdas más la propagación de singles)
+PuzzleFeatures compute_features(const SudokuBoard& board);
+
+// Nombre de un modo ("SEQUENTIAL_DANCINGLINKS", ...) y su conversión inversa
+std::string to_string(MODES mode);
+bool parse_mode(const std::string& name, MODES& mode);
+
+// Tabla de despacho del modo AUTO: asigna a cada grupo de características el solucionador que gana
+// históricamente en ese grupo. Se aprende fuera de línea a partir de los tiempos del banco de pruebas
+// (record + learn + save) y se carga de un archivo de texto con una regla por línea:
+//     <tamaño> <grupo de pistas> <grupo de densidad> <SOLVED|STUCK|CONTRADICTION> <MODO>
+// Los grupos sin regla usan default_mode.
+class SolverDispatchTable {
+public:
+    static const int NUM_CLUE_BUCKETS = 4;      // Grupos de la proporción de pistas
+    static const int NUM_DENSITY_BUCKETS = 4;   // Grupos de la densidad de candidatos
+
+    // Grupo de características (clave de la tabla)
+    struct Bucket {
+        int board_size;
+        int clues;
+        int density;
+        PROPAGATION propagation;
+        bool operator<(const Bucket& other) const;
+    };
+
+private:
+    std::map<Bucket, MODES> _table;                                    // Regla aprendida por grupo
+    std::map<Bucket, std::map<MODES, std::vector<double>>> _samples;   // Tiempos medidos (ms) por grupo y modo
+
+public:
+    static Bucket bucket_of(const PuzzleFeatures& features);
+
+    // Modo para un sudoku: el de la tabla si el grupo tiene regla, si no el de default_mode
+    MODES select(const PuzzleFeatures& features) const;
+
+    // Regla fija usada cuando no hay tabla (o el grupo no tiene regla)
+    static MODES default_mode(const PuzzleFeatures& features);
+
+    // Anota el tiempo de un modo sobre un sudoku del banco de pruebas
+    void record(const PuzzleFeatures& features, MODES mode, double milliseconds);
+
+    // Elige en cada grupo el modo con menor mediana de tiempo entre los anotados
+    void learn();
+
+    // Lee/escribe la tabla. load devuelve false si el archivo no existe o tiene una línea inválida
+    bool load(const std::string& filename);
+    bool save(const std::string& filename) const;
+
+    int size() const { return _table.size(); }
+
+    // Archivo de la tabla: variable de entorno SUDOKU_DISPATCH_TABLE o "dispatch_table.txt"
+    static std::string default_file_name();
+
+    // Tabla cargada de default_file_name() la primera vez que se pide (vacía si no existe el archivo)
+    static const SolverDispatchTable& get();
+};
+
+// Crea el solucionador del modo pedido. MODES::AUTO calcula las características del tablero y
+// usa el modo que indica la tabla de despacho.
+std::unique_ptr<SudokuSolver> CreateSudokuSolver(MODES mode, SudokuBoard& board, bool print_message = true);
+
+#endif // SUDOKUSOLVERFACTORY_HPP
@@ -4,11 +4,19 @@
 #include "SudokuBoard.hpp"     
 #include "SudokuSolver.hpp"       
 #include "SudokuBoardDeque.hpp"  
+#include "SudokuParallelProfile.hpp"
 
 // Clase SudokuSolver_ParallelBruteForce que hereda de SudokuSolver
 class SudokuSolver_ParallelBruteForce : public SudokuSolver {
 private:
     SudokuBoardDeque _board_deque;   // Deque para almacenar los tableros de Sudoku
+    ParallelConfig _config;          // Parámetros de reparto (perfil de Autotune o valores por defecto)
+
+    // Guarda la primera solución encontrada por cualquiera de los hilos
+    void store_solution(const SudokuBoard& solution);
+
+    // Acumula las estadísticas de búsqueda de un hilo o de un solucionador secuencial
+    void merge_stats(const SearchStats& stats);
 
 public:
     // Constructor que inicializa el solucionador de Sudoku paralelo de fuerza bruta
@@ -18,18 +26,19 @@ public:
     void bootstrap();
     void bootstrap(SudokuBoardDeque& boardDeque, int indexOfRows);
 
+    // Sustituye los parámetros de reparto leídos del perfil
+    void set_config(const ParallelConfig& config) { _config = config; }
+    const ParallelConfig& get_config() const { return _config; }
+
     // Resuelve el tablero de Sudoku dado usando el algoritmo de fuerza bruta paralela
-    virtual void solve() override {
-        /* Elige uno de los siguientes kernels para ejecutar */
-        solve_kernel_1();
-        // solve_kernel_2();
-        // solve_bruteforce_par(_board, 0, 0);
-    }
+    // con el kernel elegido en la configuración
+    virtual void solve() override;
 
     void solve_kernel_1();  // Definición de kernel de resolución 1
     void solve_kernel_2();  // Definición de kernel de resolución 2
-    void solve_bruteforce_seq(SudokuBoard& board, int row, int col);  // Resolución secuencial de fuerza bruta
-    void solve_bruteforce_par(SudokuBoard& board, int row, int col);  // Resolución paralela de fuerza bruta
+    void solve_kernel_3();  // Definición de kernel de resolución 3 (tareas recursivas)
+    void solve_bruteforce_seq(SudokuBoard& board, int row, int col, int depth, SearchStats& stats);  // Resolución secuencial de fuerza bruta
+    void solve_bruteforce_par(SudokuBoard& board, int row, int col, int depth = 0);  // Resolución paralela de fuerza bruta
 };
 
 #endif // SUDOKUSOLVER_PARALLELBRUTEFORCE_HPP
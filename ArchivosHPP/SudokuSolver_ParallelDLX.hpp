@@ -1,38 +1,44 @@
 #ifndef SUDOKUSOLVER_PARALLELDANCINGLINKS_HPP
 #define SUDOKUSOLVER_PARALLELDANCINGLINKS_HPP
 
-#include "SudokuBoard.hpp"   
-#include "SudokuSolver.hpp"  
-#include "Node.hpp"          
-#include <vector>           
+#include "SudokuBoard.hpp"
+#include "SudokuSolver.hpp"
+#include "DLXTemplate.hpp"
+#include "SudokuParallelProfile.hpp"
+#include <vector>
 
 class SudokuSolver_ParallelDLX : public SudokuSolver {
 private:
-    SudokuBoard _originalBoard;       // Tablero original de Sudoku
-    CoverMatrix _coverMatrix;         // Matriz de cobertura para el Sudoku
-    ColumnNode* _header;              // Nodo cabecera de la lista de DLX
-    std::vector<DancingNode*> _answer; // Vector de nodos que conforman la solución
-    int _numberOfColumns;             // _BOARD_SIZE * _BOARD_SIZE * _MAX_VALUE
-    int _numberOfRows;                // _BOARD_SIZE * _BOARD_SIZE * _NUM_CONSTRAINTS
+    DLXInstance _dlx;                 // Copia de la plantilla DLX con las pistas ya cubiertas
+    bool _consistent;                 // false si las pistas entran en conflicto entre sí
+    ParallelConfig _config;           // Parámetros de reparto (perfil de Autotune o valores por defecto)
+
+    // Recorre los split_depth primeros niveles del árbol y guarda cada camino (filas elegidas) en la frontera
+    static void expand_frontier(DLXInstance& dlx, std::vector<int>& prefix, int depth, std::vector<std::vector<int>>& frontier);
 
 public:
     // Constructor que inicializa el solucionador de Sudoku paralelo con Dancing Links
     SudokuSolver_ParallelDLX(SudokuBoard& board, bool print_message=true);
 
-    // Crea la lista de DLX a partir de la matriz de cobertura
-    ColumnNode* createDLXList(CoverMatrix& coverMatrix);
+    // Convierte las filas elegidas a un tablero de Sudoku
+    SudokuBoard convertToSudokuGrid(const DLXInstance& dlx, const std::vector<int>& answer);
 
-    // Convierte la solución en forma de nodos de DLX a un tablero de Sudoku
-    SudokuBoard convertToSudokuGrid(std::vector<DancingNode*> answer);
+    // Sustituye los parámetros de reparto leídos del perfil
+    void set_config(const ParallelConfig& config) { _config = config; }
+    const ParallelConfig& get_config() const { return _config; }
 
-    // Resuelve el tablero de Sudoku dado usando el algoritmo de Dancing Links en paralelo
-    virtual void solve() override { solve_kernel(0); }
+    // Resuelve el tablero de Sudoku dado usando el algoritmo de Dancing Links en paralelo:
+    // los subárboles de los split_depth primeros niveles se reparten entre los hilos, cada uno con su propia copia de la lista
+    virtual void solve() override;
 
-    // Función de kernel para resolver el Sudoku
-    void solve_kernel(int k);
+    // Función de kernel para resolver el Sudoku sobre la copia de un hilo; las estadísticas también son del hilo.
+    // answer empieza con el camino del subárbol (ya cubierto); la búsqueda es iterativa, con la columna de cada
+    // nivel en columns y su fila a continuación del camino en answer, como en SudokuSolver_SequentialDLX
+    void solve_kernel(DLXInstance& dlx, std::vector<int>& answer, std::vector<int>& columns, SearchStats& stats);
 
-    // Selecciona el nodo de columna usando una heurística
-    ColumnNode* selectColumnNodeHeuristic(ColumnNode* c, int k);
+    // Cuenta las soluciones hasta limit repartiendo los subárboles de la primera columna entre los hilos
+    // y sumando los conteos parciales (reducción). num_threads = 0 usa el número de hilos por defecto de OpenMP
+    int count_solutions(int limit = 2, int num_threads = 0);
 };
 
 #endif // SUDOKUSOLVER_PARALLELDANCINGLINKS_HPP
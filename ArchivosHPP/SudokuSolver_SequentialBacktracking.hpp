@@ -3,17 +3,28 @@
 
 #include "SudokuBoard.hpp"   
 #include "SudokuSolver.hpp"  
+#include <vector>
 
 // Clase SudokuSolver_SequentialBacktracking que hereda de SudokuSolver
 class SudokuSolver_SequentialBacktracking : public SudokuSolver {
+private:
+    // Punto de elección de la búsqueda: celda rellenada en un nivel y siguiente número a probar
+    struct ChoicePoint {
+        Position pos;    // Celda vacía elegida en este nivel
+        int num;         // Siguiente número a probar
+        bool last;       // El número colocado es único: no hay que probar más
+    };
+    std::vector<ChoicePoint> _stack;   // Pila explícita, reservada para todas las celdas vacías
+
 public:
     // Constructor que inicializa el solucionador de Sudoku con backtracking secuencial
     SudokuSolver_SequentialBacktracking(SudokuBoard& board, bool print_message=true);
 
     // Resuelve el tablero de Sudoku dado usando el algoritmo de backtracking secuencial
-    virtual void solve() { solve_kernel(); }
+    virtual void solve() { auto reporter = start_progress_reporter(); solve_kernel(); }
 
-    // Función kernel que implementa el algoritmo de backtracking secuencial
+    // Función kernel que implementa el algoritmo de backtracking secuencial. Es iterativa: cada nivel es una
+    // entrada de _stack en vez de una llamada recursiva, así que la profundidad no depende de la pila del hilo
     bool solve_kernel();
 };
 
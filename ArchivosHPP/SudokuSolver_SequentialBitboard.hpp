@@ -0,0 +1,22 @@
+#ifndef SUDOKUSOLVER_SEQUENTIALBITBOARD_HPP
+#define SUDOKUSOLVER_SEQUENTIALBITBOARD_HPP
+
+#include "SudokuBoard.hpp"
+#include "SudokuSolver.hpp"
+#include "BitBoard.hpp"
+
+// Clase SudokuSolver_SequentialBitboard que hereda de SudokuSolver
+class SudokuSolver_SequentialBitboard : public SudokuSolver {
+public:
+    // Constructor que inicializa el solucionador de Sudoku con backtracking sobre máscaras de bits
+    SudokuSolver_SequentialBitboard(SudokuBoard& board, bool print_message=true);
+
+    // Resuelve el tablero de Sudoku dado usando backtracking con máscaras de bits y la heurística MRV.
+    // Las cajas de 2 a 6 usan BasicBitBoard<BOX>, especializado en compilación; el resto, BitBoard
+    virtual void solve() override;
+
+    // Cuenta las soluciones del tablero hasta limit (limit = 2 basta para saber si la solución es única)
+    int count_solutions(int limit = 2);
+};
+
+#endif // SUDOKUSOLVER_SEQUENTIALBITBOARD_HPP
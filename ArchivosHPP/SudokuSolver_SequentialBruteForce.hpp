@@ -3,18 +3,29 @@
 
 #include "SudokuBoard.hpp" 
 #include "SudokuSolver.hpp" 
+#include <vector>
 
 // Clase SudokuSolver_SequentialBruteForce que hereda de SudokuSolver
 class SudokuSolver_SequentialBruteForce : public SudokuSolver {
+private:
+    // Punto de elección de la búsqueda: celda vacía rellenada en un nivel y siguiente número a probar
+    struct ChoicePoint {
+        int index;       // Índice absoluto de la celda (fila * tamaño + columna)
+        int num;         // Siguiente número a probar
+        bool last;       // El número colocado es único: no hay que probar más
+    };
+    std::vector<ChoicePoint> _stack;   // Pila explícita, reservada para todas las celdas vacías
+
 public:
     // Constructor que inicializa el solucionador de Sudoku con el algoritmo de fuerza bruta secuencial
     SudokuSolver_SequentialBruteForce(SudokuBoard& board, bool print_message=true);
 
     // Resuelve el tablero de Sudoku dado usando el algoritmo de fuerza bruta secuencial
-    virtual void solve() override { solve_kernel(0, 0); }
+    virtual void solve() override { auto reporter = start_progress_reporter(); solve_kernel(); }
 
-    // Función kernel que implementa el algoritmo de fuerza bruta secuencial
-    void solve_kernel(int row, int col);
+    // Función kernel que implementa el algoritmo de fuerza bruta secuencial. Recorre las celdas en orden y guarda
+    // cada celda vacía rellenada en _stack en vez de en una llamada recursiva
+    void solve_kernel();
 };
 
 #endif // SUDOKUSOLVER_SEQUENTIALBRUTEFORCE_HPP
@@ -1,38 +1,46 @@
 #ifndef SUDOKUSOLVER_SEQUENTIALDANCINGLINKS_HPP
 #define SUDOKUSOLVER_SEQUENTIALDANCINGLINKS_HPP
 
-#include "SudokuBoard.hpp"   
-#include "SudokuSolver.hpp"  
-#include "Node.hpp"          
-#include <vector>            
+#include "SudokuBoard.hpp"
+#include "SudokuSolver.hpp"
+#include "DLXTemplate.hpp"
+#include <vector>
 
 class SudokuSolver_SequentialDLX : public SudokuSolver {
 private:
-    CoverMatrix _coverMatrix;         // Matriz de cobertura para el Sudoku
-    ColumnNode* _header;              // Nodo cabecera de la lista de DLX
-    std::vector<DancingNode*> _answer; // Vector de nodos que conforman la solución
-    int _numberOfColumns;             // _BOARD_SIZE * _BOARD_SIZE * _MAX_VALUE
-    int _numberOfRows;                // _BOARD_SIZE * _BOARD_SIZE * _NUM_CONSTRAINTS
+    DLXInstance _dlx;                 // Copia de la plantilla DLX con las pistas ya cubiertas
+    bool _consistent;                 // false si las pistas entran en conflicto entre sí
+    std::vector<int> _answer;         // Nodos (filas de cobertura) que conforman la solución
+    std::vector<int> _columns;        // Columna cubierta en cada nivel (pila explícita junto con _answer)
 
 public:
     // Constructor que inicializa el solucionador de Sudoku secuencial con Dancing Links
     SudokuSolver_SequentialDLX(SudokuBoard& board, bool print_message=true);
 
-    // Crea la lista cuádruplemente enlazada para representar la matriz de cobertura
-    ColumnNode* createDLXList(CoverMatrix& coverMatrix);
-
-    // Convierte la lista cuádruplemente enlazada al equivalente del tablero de Sudoku resuelto
-    SudokuBoard convertToSudokuGrid(std::vector<DancingNode*> answer);
+    // Convierte las filas elegidas al equivalente del tablero de Sudoku resuelto
+    SudokuBoard convertToSudokuGrid(const std::vector<int>& answer);
 
     // Resuelve el tablero de Sudoku dado usando el algoritmo de Dancing Links secuencial
-    virtual void solve() override { solve_kernel(0); }
+    virtual void solve() override { if (_consistent) { solve_kernel(); } }
 
     // Implementación del Algoritmo X (https://en.wikipedia.org/wiki/Knuth%27s_Algorithm_X) y
-    // uso de Dancing Links en la lista cuádruplemente enlazada para resolver el problema de cobertura exacta
-    void solve_kernel(int k);
-
-    // Selecciona el nodo de columna usando una heurística
-    ColumnNode* selectColumnNodeHeuristic(ColumnNode* c, int k);
+    // uso de Dancing Links sobre la copia de la plantilla para resolver el problema de cobertura exacta.
+    // Es iterativa: la columna y la fila de cada nivel se guardan en _columns y _answer
+    void solve_kernel();
+
+    // Cuenta las soluciones hasta limit (limit = 2 basta para saber si la solución es única)
+    int count_solutions(int limit = 2);
+
+    // Núcleo del conteo: recorre el árbol de búsqueda sobre dlx hasta alcanzar limit soluciones.
+    // Es iterativo, con la misma pila de columnas y filas que solve_kernel
+    static void count_kernel(DLXInstance& dlx, int limit, int& count);
+
+    // Operaciones sobre una pila explícita (columns[i] es la columna del nivel i y la fila elegida es la última
+    // de rows que le corresponde; rows puede empezar con filas de un camino ya cubierto, que no se tocan).
+    // backtrack pasa a la siguiente fila del nivel más profundo que la tenga y devuelve false cuando se ha
+    // recorrido todo el árbol; unwind deshace todos los niveles. stats puede ser nullptr
+    static bool backtrack(DLXInstance& dlx, std::vector<int>& rows, std::vector<int>& columns, SearchStats* stats);
+    static void unwind(DLXInstance& dlx, std::vector<int>& rows, std::vector<int>& columns);
 };
 
 #endif // SUDOKUSOLVER_SEQUENTIALDANCINGLINKS_HPP
@@ -3,11 +3,20 @@
 
 #include "SudokuBoard.hpp"  
 #include "SudokuSolver.hpp"  
+#include <vector>
 
 class SudokuSolver_SequentialForwardChecking : public SudokuSolver {
 private:
     StateMatrix _stateMatrix;  // Matriz de estado para el Sudoku
 
+    // Nivel de la búsqueda: matriz de estado ya propagada y siguiente (celda, valor) a probar en ella
+    struct Frame {
+        StateMatrix stateMatrix;   // Estado de este nivel
+        int cell;                  // Celda abierta actual (fila * tamaño + columna)
+        int value;                 // Último valor probado en esa celda
+    };
+    std::vector<Frame> _stack;     // Pila explícita, reservada para un nivel por celda
+
 public:
     // Constructor que inicializa el solucionador de Sudoku con forward checking secuencial
     SudokuSolver_SequentialForwardChecking(SudokuBoard& board, bool print_message=true);
@@ -18,8 +27,9 @@ public:
     // Resuelve el tablero de Sudoku dado usando el algoritmo de forward checking secuencial
     virtual void solve() override { solve_kernel(_stateMatrix); }
 
-    // Función kernel que implementa el algoritmo de forward checking secuencial
-    void solve_kernel(StateMatrix& stateMatrix);
+    // Función kernel que implementa el algoritmo de forward checking secuencial a partir de stateMatrix.
+    // Es iterativa: cada decisión apila un Frame con su copia de la matriz en vez de una llamada recursiva
+    void solve_kernel(const StateMatrix& stateMatrix);
 
     /* 
      * Propaga un paso.
@@ -5,7 +5,7 @@
 #include "termcolor.hpp"      
 #include <iostream>          
 #include <cassert>           
-#include <set>                
+#include <vector>
 
 #define ASSERT_WITH_MESSAGE(condition, message) do { \
     if (!(condition)) { \
@@ -24,11 +24,26 @@ private:
     SudokuTest() { }
 
 public:
+    // Las comprobaciones recorren el tablero una vez con una máscara de bits por fila, columna y caja.
+    // Un valor fuera de 1..N invalida las filas, las columnas y las cajas.
     static bool checkValidSizes(const SudokuBoard& board);
     static bool checkValidRows(const SudokuBoard& board);
     static bool checkValidColumns(const SudokuBoard& board);
     static bool checkValidBoxes(const SudokuBoard& board);
 
+    // Tamaño, filas, columnas y cajas en una sola pasada
+    static bool checkValidBoard(const SudokuBoard& board);
+
+    // La solución tiene el tamaño del puzle, está completa, es válida y respeta todas sus pistas (una sola pasada)
+    static bool checkSolution(const SudokuBoard& puzzle, const SudokuBoard& solution);
+
+    // Verificación por lotes, repartida entre num_threads hilos (0 = todos). valid[i] queda a 1 si el tablero
+    // (o el par puzle/solución) i es correcto; devuelven el número de incorrectos. Una solución sin puzle
+    // correspondiente cuenta como incorrecta
+    static int checkValidBoards(const std::vector<SudokuBoard>& boards, std::vector<char>& valid, int num_threads = 0);
+    static int checkSolutions(const std::vector<SudokuBoard>& puzzles, const std::vector<SudokuBoard>& solutions,
+                              std::vector<char>& valid, int num_threads = 0);
+
     static bool expect(int flags, int mask) {
         return flags && mask;
     }
@@ -0,0 +1,17 @@
+#ifndef SUDOKUUNIQUENESS_HPP
+#define SUDOKUUNIQUENESS_HPP
+
+#include "SudokuBoard.hpp"
+
+// Cuenta las soluciones del tablero hasta limit.
+// Usa el backtracking con máscaras de bits (BasicBitBoard, propagando singles desnudos y ocultos) en todos los
+// tamaños que admite BitBoard (hasta 64x64): con la propagación poda tanto como DLX y cada nodo es mucho más
+// barato. Solo en tableros mayores recurre a DLX.
+// Con num_threads > 1 el árbol se divide en subárboles que se reparten entre los hilos (OpenMP)
+// y los conteos parciales se suman con una reducción.
+int count_solutions(const SudokuBoard& board, int limit = 2, int num_threads = 1);
+
+// Devuelve true si el tablero tiene exactamente una solución
+bool has_unique_solution(const SudokuBoard& board, int num_threads = 1);
+
+#endif // SUDOKUUNIQUENESS_HPP
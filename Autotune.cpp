@@ -0,0 +1,179 @@
+#include "SudokuBoard.hpp"
+#include "SudokuSolver.hpp"
+#include "SudokuSolver_ParallelBruteForce.hpp"
+#include "SudokuSolver_ParallelDLX.hpp"
+#include "SudokuSolverFactory.hpp"
+#include "SudokuParallelProfile.hpp"
+#include "termcolor.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <omp.h>
+#include <string>
+#include <vector>
+
+#define REPETICIONES 3                   // Repeticiones por sudoku y configuración (se usa la mediana)
+#define BRUTEFORCE_MAX_BOARD_SIZE 9      // La fuerza bruta es exponencial: solo se ajusta hasta 9x9
+
+using namespace std;
+
+// Herramienta de ajuste automático de los parámetros paralelos.
+// Para cada tamaño de tablero del corpus y cada modo paralelo prueba todas las combinaciones de hilos,
+// profundidad/tamaño de la frontera y umbral de tareas, y guarda la más rápida en el perfil que leen
+// los solucionadores paralelos al construirse (ver ParallelProfile).
+//
+// Uso: Autotune [-o perfil] [-r repeticiones] sudoku1.txt sudoku2.txt ...
+
+void mostrarUso() {
+    cerr << "Uso: Autotune [-o perfil] [-r repeticiones] sudoku1.txt [sudoku2.txt ...]\n";
+    cerr << "    -o: archivo del perfil (por defecto " << ParallelProfile::default_file_name() << ")\n";
+    cerr << "    -r: repeticiones por sudoku y configuración (por defecto " << REPETICIONES << ")\n";
+}
+
+// Resuelve el sudoku con un modo y una configuración y devuelve el tiempo en milisegundos
+// (infinito si no se encontró la solución)
+double resolver(MODES mode, const ParallelConfig& config, SudokuBoard& board) {
+    auto start = chrono::steady_clock::now();
+    bool resuelto;
+    if (mode == MODES::PARALLEL_DANCINGLINKS) {
+        SudokuSolver_ParallelDLX solver(board, false);
+        solver.set_config(config);
+        solver.solve();
+        resuelto = solver.get_status();
+    } else {
+        SudokuSolver_ParallelBruteForce solver(board, false);
+        solver.set_config(config);
+        solver.solve();
+        resuelto = solver.get_status();
+    }
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    return resuelto ? ms : numeric_limits<double>::infinity();
+}
+
+// Suma sobre el corpus de la mediana de las repeticiones de cada sudoku
+double medir(MODES mode, const ParallelConfig& config, vector<SudokuBoard>& corpus, int repeticiones) {
+    double total = 0.0;
+    for (SudokuBoard& board : corpus) {
+        vector<double> tiempos;
+        for (int i = 0; i < repeticiones; ++i) {
+            tiempos.push_back(resolver(mode, config, board));
+        }
+        sort(tiempos.begin(), tiempos.end());
+        total += tiempos[tiempos.size() / 2];
+    }
+    return total;
+}
+
+// Configuraciones a probar para un modo
+vector<ParallelConfig> candidatos(MODES mode) {
+    vector<int> hilos;
+    for (int t = 1; t < omp_get_max_threads(); t *= 2) { hilos.push_back(t); }
+    hilos.push_back(omp_get_max_threads());
+
+    vector<ParallelConfig> configs;
+    for (int t : hilos) {
+        ParallelConfig config;
+        config.num_threads = t;
+        if (mode == MODES::PARALLEL_DANCINGLINKS) {
+            for (int depth : { 1, 2, 3, 4 }) {
+                config.split_depth = depth;
+                configs.push_back(config);
+            }
+        } else {
+            config.kernel = 1;   // Frontera BFS de tamaño proporcional a los hilos
+            for (int porHilo : { 1, 2, 4, 8, 16 }) {
+                config.frontier_size = porHilo * t;
+                configs.push_back(config);
+            }
+            config.frontier_size = 0;
+            config.kernel = 2;   // Frontera por filas (sin parámetros)
+            configs.push_back(config);
+            config.kernel = 3;   // Tareas recursivas con umbral de profundidad
+            for (int cutoff : { 1, 2, 3, 4, 6 }) {
+                config.task_cutoff = cutoff;
+                configs.push_back(config);
+            }
+        }
+    }
+    return configs;
+}
+
+void imprimir(const ParallelConfig& config) {
+    cout << "hilos=" << config.num_threads << " split_depth=" << config.split_depth << " kernel=" << config.kernel
+         << " frontier_size=" << config.frontier_size << " task_cutoff=" << config.task_cutoff;
+}
+
+int main(int argc, char** argv) {
+    string archivoPerfil = ParallelProfile::default_file_name();
+    int repeticiones = REPETICIONES;
+    vector<string> archivos;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "-o" && i + 1 < argc) {
+            archivoPerfil = argv[++i];
+        } else if (arg == "-r" && i + 1 < argc) {
+            repeticiones = max(1, atoi(argv[++i]));
+        } else {
+            archivos.push_back(arg);
+        }
+    }
+    if (archivos.empty()) {
+        mostrarUso();
+        return -1;
+    }
+
+    // Agrupar el corpus por tamaño de tablero
+    map<int, vector<SudokuBoard>> corpus;
+    for (const string& archivo : archivos) {
+        SudokuBoard board(archivo);
+        corpus[board.get_board_size()].push_back(board);
+    }
+
+    // Se parte del perfil existente para conservar los tamaños que no están en este corpus
+    ParallelProfile profile;
+    profile.load(archivoPerfil);
+
+    for (auto& grupo : corpus) {
+        int N = grupo.first;
+        for (MODES mode : { MODES::PARALLEL_DANCINGLINKS, MODES::PARALLEL_BRUTEFORCE }) {
+            if (mode == MODES::PARALLEL_BRUTEFORCE && N > BRUTEFORCE_MAX_BOARD_SIZE) { continue; }
+
+            cout << termcolor::red << "\n" << to_string(mode) << " " << N << "x" << N << " (" << grupo.second.size()
+                 << " sudokus)\n" << termcolor::reset;
+            medir(mode, ParallelConfig(), grupo.second, 1);   // Calentamiento (plantilla DLX, cachés)
+
+            ParallelConfig mejor;
+            double mejorTiempo = numeric_limits<double>::infinity();
+            for (const ParallelConfig& config : candidatos(mode)) {
+                double ms = medir(mode, config, grupo.second, repeticiones);
+                imprimir(config);
+                cout << ": " << ms << " ms\n";
+                if (ms < mejorTiempo) {
+                    mejorTiempo = ms;
+                    mejor = config;
+                }
+            }
+
+            // Ninguna configuración resolvió el corpus: no hay nada que guardar y se conserva la entrada anterior
+            if (mejorTiempo == numeric_limits<double>::infinity()) {
+                cerr << termcolor::yellow << "Aviso: ninguna configuración resolvió todos los sudokus de " << N << "x" << N
+                     << " con " << to_string(mode) << "; se conserva el perfil anterior" << termcolor::reset << "\n";
+                continue;
+            }
+
+            cout << termcolor::green << "Mejor: ";
+            imprimir(mejor);
+            cout << " (" << mejorTiempo << " ms)\n" << termcolor::reset;
+            profile.set(mode, N, mejor);
+        }
+    }
+
+    if (!profile.save(archivoPerfil)) {
+        cerr << termcolor::red << "Error escribiendo el perfil " << archivoPerfil << termcolor::reset << "\n";
+        return -1;
+    }
+    cout << "Perfil guardado en " << archivoPerfil << "\n";
+    return 0;
+}
@@ -0,0 +1,645 @@
+#include "ParallelTrace.hpp"
+#include "PerfCounters.hpp"
+#include "SudokuBoard.hpp"
+#include "SudokuSolver.hpp"
+#include "SudokuSolverFactory.hpp"
+#include "SudokuTest.hpp"
+#include "termcolor.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <omp.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define WARMUP 2                        // Ejecuciones de calentamiento por caso (no se miden)
+#define REPETICIONES 10                 // Ejecuciones medidas por caso
+#define SLOW_MODES_MAX_BOARD_SIZE 9     // Los modos exponenciales solo se miden hasta 9x9 (salvo con -a)
+#define BITBOARD_MAX_BOARD_SIZE 16      // El backtracking con máscaras de bits se atasca en los 25x25 difíciles
+#define TOLERANCIA 0.05                 // Empeoramiento relativo de la media que se admite al comparar con la línea base
+#define RUIDO_MINIMO_MS 0.01            // Diferencias por debajo de la resolución práctica del reloj no cuentan como regresión
+
+using namespace std;
+
+// Banco de pruebas: ejecuta cada modo sobre cada sudoku del corpus con calentamiento y repeticiones,
+// mide por separado las fases (lectura, preparación del solucionador, resolución y verificación) e informa
+// de la mediana, p95, p99 y el rendimiento en una tabla y, opcionalmente, en JSON.
+// Con -c compara cada modo, caso y fase con una línea base guardada antes con -j: calcula el intervalo de confianza
+// del 95% de la diferencia de medias (Welch) y marca como regresión la fase cuyo intervalo queda entero por encima
+// de la tolerancia. Si hay regresiones el programa termina con código 1, para poder usarlo como puerta en la CI.
+// Con -p lee además los contadores hardware (ciclos, instrucciones, fallos de caché y de predicción de saltos)
+// alrededor de solve() y da su mediana junto al tiempo. Si se compila con -DSUDOKU_SEARCH_STATS=1 también informa
+// de las estadísticas del árbol de búsqueda (nodos, retrocesos, eliminaciones, profundidad y ramificación), que no
+// dependen del ruido de la máquina.
+// Con -l y -n cada resolución se corta al pasar el tiempo o los nodos dados (SudokuSolver::solve_with_options);
+// las repeticiones cortadas cuentan como no resueltas.
+// Con -t guarda la línea de tiempo de los hilos de los solucionadores paralelos durante la última repetición de cada
+// caso, en JSON de Chrome trace (chrome://tracing o ui.perfetto.dev).
+//
+// Uso: Benchmark [-m 3,4,6,9] [-w calentamiento] [-r repeticiones] [-a] [-p] [-j salida.json] [-d tabla]
+//                [-c base.json] [-u tolerancia] [-t traza.json] [-l ms] [-n nodos] sudoku1.txt ...
+// Sin archivos usa los casos de prueba de Main (..\Test_Cases\<tamaño>_<dificultad>.txt).
+
+enum PHASE { PARSE, SETUP, SOLVE, VERIFY, TOTAL, NUM_PHASES };
+const char* PHASE_NAMES[NUM_PHASES] = { "parse", "setup", "solve", "verify", "total" };
+
+// Resultado de un modo sobre un caso
+struct Resultado {
+    MODES mode;
+    string caso;
+    int board_size;
+    bool solved = true;                   // false si alguna repetición no encontró una solución válida
+    vector<double> muestras[NUM_PHASES];  // Milisegundos por repetición y fase
+    vector<double> contadores[NUM_PERF_COUNTERS];  // Contadores hardware de solve() por repetición (con -p)
+    SearchStats busqueda;                 // Estadísticas de búsqueda de la última repetición
+    int cortadas = 0;                     // Repeticiones que alcanzaron el límite de tiempo o de nodos
+    SOLVE_STATUS estado = SOLVE_STATUS::RUNNING;   // Estado de la última repetición
+};
+
+void mostrarUso() {
+    cerr << "Uso: Benchmark [-m modos] [-w calentamiento] [-r repeticiones] [-a] [-p] [-j salida.json] [-d tabla] [-c base.json] [-u tolerancia] [-t traza.json] [-l ms] [-n nodos] sudoku1.txt ...\n";
+    cerr << "    -m: modos separados por comas (0-6, 9 = automático); por defecto todos\n";
+    cerr << "    -w: ejecuciones de calentamiento por caso (por defecto " << WARMUP << ")\n";
+    cerr << "    -r: repeticiones medidas por caso (por defecto " << REPETICIONES << ")\n";
+    cerr << "    -a: medir todos los modos en todos los tamaños (por defecto los modos exponenciales solo hasta "
+         << SLOW_MODES_MAX_BOARD_SIZE << "x" << SLOW_MODES_MAX_BOARD_SIZE << " y el de máscaras de bits hasta "
+         << BITBOARD_MAX_BOARD_SIZE << "x" << BITBOARD_MAX_BOARD_SIZE << ")\n";
+    cerr << "    -p: lee los contadores hardware de la CPU durante la resolución (solo Linux)\n";
+    cerr << "    -j: escribe los resultados en JSON\n";
+    cerr << "    -d: aprende la tabla de despacho del modo automático y la guarda en el archivo\n";
+    cerr << "    -c: compara con una línea base escrita con -j y termina con código 1 si hay regresiones\n";
+    cerr << "    -t: guarda la traza de los hilos (JSON de Chrome trace) de la última repetición de cada caso\n";
+    cerr << "    -l: tiempo máximo de cada resolución en milisegundos\n";
+    cerr << "    -n: nodos máximos del árbol de búsqueda en cada resolución\n";
+    cerr << "    -u: empeoramiento relativo tolerado al comparar (por defecto " << TOLERANCIA << ")\n";
+}
+
+// Tamaño máximo de tablero en el que se mide un modo por defecto: la búsqueda exhaustiva sin poda por
+// restricciones es inviable en tableros grandes
+int tamanoMaximo(MODES mode) {
+    switch (mode) {
+        case MODES::SEQUENTIAL_BACKTRACKING:
+        case MODES::SEQUENTIAL_BRUTEFORCE:
+        case MODES::PARALLEL_BRUTEFORCE:
+        case MODES::SEQUENTIAL_FORWARDCHECKING:
+            return SLOW_MODES_MAX_BOARD_SIZE;
+        case MODES::SEQUENTIAL_BITBOARD:
+            return BITBOARD_MAX_BOARD_SIZE;
+        default:
+            return numeric_limits<int>::max();
+    }
+}
+
+// Comprueba que la solución está completa, es válida y respeta las pistas
+bool verificar(const SudokuBoard& board, const SudokuBoard& solution) {
+    return SudokuTest::checkSolution(board, solution);
+}
+
+double milisegundos(chrono::steady_clock::time_point inicio, chrono::steady_clock::time_point fin) {
+    return chrono::duration<double, milli>(fin - inicio).count();
+}
+
+// Ejecuta una vez todas las fases y añade los tiempos al resultado (si medir es true).
+// Si se pasan contadores, también sus valores durante solve(). limiteMs y limiteNodos (0 = sin límite) cortan la resolución
+void ejecutar(const string& archivo, Resultado& resultado, bool medir, PerfCounters* contadores,
+              long long limiteMs, long long limiteNodos) {
+    auto t0 = chrono::steady_clock::now();
+    SudokuBoard board(archivo, false);
+    auto t1 = chrono::steady_clock::now();
+    unique_ptr<SudokuSolver> solver = CreateSudokuSolver(resultado.mode, board, false);
+    auto t2 = chrono::steady_clock::now();
+    SolveOptions opciones;
+    if (limiteMs > 0) { opciones.set_time_limit(limiteMs); }
+    opciones.node_budget = limiteNodos;
+    PerfSample muestra;
+    if (contadores != nullptr) { contadores->start(); }
+    SolveResult resolucion = solver->solve_with_options(opciones);
+    if (contadores != nullptr) { muestra = contadores->stop(); }
+    auto t3 = chrono::steady_clock::now();
+    bool valido = solver->get_status() && verificar(board, solver->get_solution());
+    auto t4 = chrono::steady_clock::now();
+
+    if (!medir) { return; }
+    resultado.solved = resultado.solved && valido;
+    resultado.estado = resolucion.status;
+    if (resolucion.status != SOLVE_STATUS::SOLVED && resolucion.status != SOLVE_STATUS::NO_SOLUTION) { ++resultado.cortadas; }
+    resultado.muestras[PARSE].push_back(milisegundos(t0, t1));
+    resultado.muestras[SETUP].push_back(milisegundos(t1, t2));
+    resultado.muestras[SOLVE].push_back(milisegundos(t2, t3));
+    resultado.muestras[VERIFY].push_back(milisegundos(t3, t4));
+    resultado.muestras[TOTAL].push_back(milisegundos(t0, t4));
+    for (int i = 0; i < NUM_PERF_COUNTERS; ++i) {
+        if (muestra.valid[i]) { resultado.contadores[i].push_back((double)muestra.value[i]); }
+    }
+    resultado.busqueda = solver->get_stats();
+}
+
+// Percentil p (0-100) por el método del rango más cercano
+double percentil(vector<double> muestras, double p) {
+    if (muestras.empty()) { return 0.0; }
+    sort(muestras.begin(), muestras.end());
+    int rango = max(1, (int)ceil(p / 100.0 * muestras.size()));
+    return muestras[rango - 1];
+}
+
+double media(const vector<double>& muestras) {
+    double suma = 0.0;
+    for (double m : muestras) { suma += m; }
+    return muestras.empty() ? 0.0 : suma / muestras.size();
+}
+
+// Desviación típica muestral (n - 1)
+double desviacion(const vector<double>& muestras) {
+    if (muestras.size() < 2) { return 0.0; }
+    double m = media(muestras);
+    double suma = 0.0;
+    for (double x : muestras) { suma += (x - m) * (x - m); }
+    return sqrt(suma / (muestras.size() - 1));
+}
+
+// Sudokus por segundo de principio a fin
+double rendimiento(const Resultado& resultado) {
+    double ms = media(resultado.muestras[TOTAL]);
+    return (ms > 0.0) ? 1000.0 / ms : 0.0;
+}
+
+void imprimirTabla(const vector<Resultado>& resultados) {
+    cout << left << setw(28) << "modo" << setw(24) << "caso" << setw(8) << "fase"
+         << right << setw(12) << "mediana ms" << setw(12) << "p95 ms" << setw(12) << "p99 ms" << "\n";
+    cout << string(96, '-') << "\n";
+    for (const Resultado& r : resultados) {
+        for (int fase = 0; fase < NUM_PHASES; ++fase) {
+            cout << left << setw(28) << (fase == 0 ? to_string(r.mode) : "") << setw(24) << (fase == 0 ? r.caso : "")
+                 << setw(8) << PHASE_NAMES[fase] << right << fixed << setprecision(4)
+                 << setw(12) << percentil(r.muestras[fase], 50)
+                 << setw(12) << percentil(r.muestras[fase], 95)
+                 << setw(12) << percentil(r.muestras[fase], 99) << "\n";
+        }
+        cout << (r.solved ? termcolor::green : termcolor::red) << "    " << (r.solved ? "resuelto" : "NO RESUELTO")
+             << termcolor::reset << ", " << setprecision(2) << rendimiento(r) << " sudokus/s";
+        if (r.cortadas > 0) { cout << termcolor::yellow << ", " << r.cortadas << " cortadas por el límite (" << to_string(r.estado) << ")" << termcolor::reset; }
+        cout << "\n";
+        if (!r.contadores[CYCLES].empty()) {
+            // Medianas de los contadores de solve(): IPC bajo con muchos fallos de caché apunta a la persecución de
+            // punteros (DLX); muchos fallos de predicción, a los saltos de la búsqueda por fuerza bruta
+            cout << "    solve:";
+            for (int i = 0; i < NUM_PERF_COUNTERS; ++i) {
+                if (!r.contadores[i].empty()) { cout << " " << PERF_COUNTER_NAMES[i] << "=" << (long long)percentil(r.contadores[i], 50); }
+            }
+            if (!r.contadores[INSTRUCTIONS].empty() && percentil(r.contadores[CYCLES], 50) > 0) {
+                cout << " ipc=" << percentil(r.contadores[INSTRUCTIONS], 50) / percentil(r.contadores[CYCLES], 50);
+            }
+            cout << "\n";
+        }
+        if (SearchStats::enabled) {
+            const SearchStats& s = r.busqueda;
+            cout << "    búsqueda: nodos=" << s.nodes() << " retrocesos=" << s.backtracks() << " eliminaciones=" << s.eliminations()
+                 << " profundidad_max=" << s.max_depth() << " ramificación_media=" << s.mean_branching() << "\n";
+        }
+        cout.unsetf(ios::fixed);
+        cout << setprecision(6);
+    }
+}
+
+// Escapa las barras invertidas y comillas de una cadena JSON
+string json(const string& s) {
+    string escapada = "\"";
+    for (char c : s) {
+        if (c == '\\' || c == '"') { escapada += '\\'; }
+        escapada += c;
+    }
+    return escapada + "\"";
+}
+
+bool escribirJSON(const vector<Resultado>& resultados, const string& archivo, int calentamiento, int repeticiones) {
+    ofstream out(archivo);
+    if (!out.is_open()) { return false; }
+
+    out << "{\n  \"warmup\": " << calentamiento << ",\n  \"repetitions\": " << repeticiones
+        << ",\n  \"threads\": " << omp_get_max_threads() << ",\n  \"results\": [\n";
+    for (size_t i = 0; i < resultados.size(); ++i) {
+        const Resultado& r = resultados[i];
+        out << "    {\"mode\": " << json(to_string(r.mode)) << ", \"case\": " << json(r.caso)
+            << ", \"board_size\": " << r.board_size << ", \"solved\": " << (r.solved ? "true" : "false")
+            << ", \"status\": " << json(to_string(r.estado)) << ", \"limited_runs\": " << r.cortadas
+            << ", \"throughput_per_s\": " << rendimiento(r) << ", \"phases\": {";
+        for (int fase = 0; fase < NUM_PHASES; ++fase) {
+            out << (fase ? ", " : "") << "\"" << PHASE_NAMES[fase] << "\": {\"median_ms\": " << percentil(r.muestras[fase], 50)
+                << ", \"p95_ms\": " << percentil(r.muestras[fase], 95) << ", \"p99_ms\": " << percentil(r.muestras[fase], 99)
+                << ", \"mean_ms\": " << media(r.muestras[fase]) << ", \"stddev_ms\": " << desviacion(r.muestras[fase])
+                << ", \"samples_ms\": [";
+            for (size_t m = 0; m < r.muestras[fase].size(); ++m) { out << (m ? ", " : "") << r.muestras[fase][m]; }
+            out << "]}";
+        }
+        out << "}";
+        if (!r.contadores[CYCLES].empty()) {
+            out << ", \"counters\": {";
+            bool primero = true;
+            for (int c = 0; c < NUM_PERF_COUNTERS; ++c) {
+                if (r.contadores[c].empty()) { continue; }
+                out << (primero ? "" : ", ") << "\"" << PERF_COUNTER_NAMES[c] << "\": " << (long long)percentil(r.contadores[c], 50);
+                primero = false;
+            }
+            out << "}";
+        }
+        if (SearchStats::enabled) {
+            // branching[profundidad][factor] = nodos de esa profundidad con ese factor de ramificación
+            const SearchStats& s = r.busqueda;
+            out << ", \"search\": {\"nodes\": " << s.nodes() << ", \"backtracks\": " << s.backtracks()
+                << ", \"eliminations\": " << s.eliminations() << ", \"max_depth\": " << s.max_depth()
+                << ", \"mean_branching\": " << s.mean_branching() << ", \"branching\": [";
+            for (size_t d = 0; d < s.branching().size(); ++d) {
+                out << (d ? ", " : "") << "[";
+                for (size_t f = 0; f < s.branching()[d].size(); ++f) { out << (f ? ", " : "") << s.branching()[d][f]; }
+                out << "]";
+            }
+            out << "]}";
+        }
+        out << "}" << (i + 1 < resultados.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+    return out.good();
+}
+
+// Valor JSON genérico, lo justo para leer de vuelta la línea base escrita por escribirJSON
+struct ValorJSON {
+    enum TIPO { NULO, BOOLEANO, NUMERO, CADENA, LISTA, OBJETO } tipo = NULO;
+    bool booleano = false;
+    double numero = 0.0;
+    string cadena;
+    vector<ValorJSON> lista;
+    vector<pair<string, ValorJSON>> objeto;
+
+    // Miembro de un objeto por nombre (nullptr si no existe)
+    const ValorJSON* campo(const string& nombre) const {
+        for (const auto& par : objeto) {
+            if (par.first == nombre) { return &par.second; }
+        }
+        return nullptr;
+    }
+};
+
+// Analizador descendente recursivo de JSON; devuelve false ante cualquier error de sintaxis
+class LectorJSON {
+private:
+    const string& _texto;
+    size_t _pos = 0;
+
+    void saltarEspacios() {
+        while (_pos < _texto.size() && isspace((unsigned char)_texto[_pos])) { ++_pos; }
+    }
+
+    bool consumir(char c) {
+        saltarEspacios();
+        if (_pos < _texto.size() && _texto[_pos] == c) { ++_pos; return true; }
+        return false;
+    }
+
+    bool literal(const string& palabra) {
+        if (_texto.compare(_pos, palabra.size(), palabra) != 0) { return false; }
+        _pos += palabra.size();
+        return true;
+    }
+
+    bool leerCadena(string& cadena) {
+        if (!consumir('"')) { return false; }
+        cadena.clear();
+        while (_pos < _texto.size() && _texto[_pos] != '"') {
+            char c = _texto[_pos++];
+            if (c == '\\') {
+                if (_pos >= _texto.size()) { return false; }
+                c = _texto[_pos++];
+                if (c == 'n') { c = '\n'; }
+                else if (c == 't') { c = '\t'; }
+            }
+            cadena += c;
+        }
+        return consumir('"');
+    }
+
+public:
+    LectorJSON(const string& texto) : _texto(texto) {}
+
+    bool leer(ValorJSON& valor) {
+        saltarEspacios();
+        if (_pos >= _texto.size()) { return false; }
+        char c = _texto[_pos];
+        if (c == '{') {
+            valor.tipo = ValorJSON::OBJETO;
+            ++_pos;
+            if (consumir('}')) { return true; }
+            do {
+                pair<string, ValorJSON> par;
+                if (!leerCadena(par.first) || !consumir(':') || !leer(par.second)) { return false; }
+                valor.objeto.push_back(move(par));
+            } while (consumir(','));
+            return consumir('}');
+        }
+        if (c == '[') {
+            valor.tipo = ValorJSON::LISTA;
+            ++_pos;
+            if (consumir(']')) { return true; }
+            do {
+                valor.lista.emplace_back();
+                if (!leer(valor.lista.back())) { return false; }
+            } while (consumir(','));
+            return consumir(']');
+        }
+        if (c == '"') {
+            valor.tipo = ValorJSON::CADENA;
+            return leerCadena(valor.cadena);
+        }
+        if (literal("true") || literal("false")) {
+            valor.tipo = ValorJSON::BOOLEANO;
+            valor.booleano = (_texto[_pos - 1] == 'e' && _texto[_pos - 2] == 'u');
+            return true;
+        }
+        if (literal("null")) { return true; }
+
+        const char* inicio = _texto.c_str() + _pos;
+        char* fin = nullptr;
+        valor.tipo = ValorJSON::NUMERO;
+        valor.numero = strtod(inicio, &fin);
+        if (fin == inicio) { return false; }
+        _pos += fin - inicio;
+        return true;
+    }
+
+    // true si tras el valor solo quedan espacios
+    bool terminado() {
+        saltarEspacios();
+        return _pos == _texto.size();
+    }
+};
+
+// Carga los resultados (con sus muestras) de un JSON escrito por escribirJSON
+bool leerJSON(const string& archivo, vector<Resultado>& resultados) {
+    ifstream in(archivo);
+    if (!in.is_open()) { return false; }
+    stringstream contenido;
+    contenido << in.rdbuf();
+    string texto = contenido.str();
+
+    ValorJSON raiz;
+    LectorJSON lector(texto);
+    if (!lector.leer(raiz) || !lector.terminado()) { return false; }
+    const ValorJSON* lista = raiz.campo("results");
+    if (lista == nullptr || lista->tipo != ValorJSON::LISTA) { return false; }
+
+    for (const ValorJSON& elemento : lista->lista) {
+        const ValorJSON* modo = elemento.campo("mode");
+        const ValorJSON* caso = elemento.campo("case");
+        const ValorJSON* fases = elemento.campo("phases");
+        Resultado r;
+        if (modo == nullptr || caso == nullptr || fases == nullptr || !parse_mode(modo->cadena, r.mode)) { return false; }
+        r.caso = caso->cadena;
+        if (const ValorJSON* tamano = elemento.campo("board_size")) { r.board_size = (int)tamano->numero; }
+        if (const ValorJSON* resuelto = elemento.campo("solved")) { r.solved = resuelto->booleano; }
+
+        for (int fase = 0; fase < NUM_PHASES; ++fase) {
+            const ValorJSON* datos = fases->campo(PHASE_NAMES[fase]);
+            if (datos == nullptr) { continue; }
+            const ValorJSON* muestras = datos->campo("samples_ms");
+            const ValorJSON* mediana = datos->campo("median_ms");
+            if (muestras != nullptr) {
+                for (const ValorJSON& m : muestras->lista) { r.muestras[fase].push_back(m.numero); }
+            } else if (mediana != nullptr) {
+                // Línea base antigua sin muestras: solo la mediana, sin varianza
+                r.muestras[fase].push_back(mediana->numero);
+            }
+        }
+        resultados.push_back(r);
+    }
+    return true;
+}
+
+// Cuantil 0.975 de la t de Student para df grados de libertad (1.96 a partir de 30)
+double tStudent(double df) {
+    static const double TABLA[] = { 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042 };
+    int grados = (int)floor(df);
+    if (grados < 1) { return TABLA[0]; }
+    return (grados <= 30) ? TABLA[grados - 1] : 1.96;
+}
+
+// Compara cada resultado con su línea base y devuelve el número de regresiones.
+// Para cada fase calcula el intervalo de confianza del 95% de (media actual - media base) con la
+// aproximación de Welch: es regresión si todo el intervalo supera tolerancia * media base (y el ruido del reloj),
+// y mejora si todo el intervalo queda por debajo de -tolerancia * media base
+int compararConBase(const vector<Resultado>& resultados, const vector<Resultado>& base, double tolerancia) {
+    int regresiones = 0;
+    cout << left << setw(28) << "modo" << setw(24) << "caso" << setw(8) << "fase"
+         << right << setw(12) << "base ms" << setw(12) << "actual ms" << setw(10) << "cambio"
+         << setw(26) << "IC 95% diferencia ms" << "  estado\n";
+    cout << string(128, '-') << "\n";
+
+    for (const Resultado& r : resultados) {
+        auto it = find_if(base.begin(), base.end(), [&](const Resultado& b) { return b.mode == r.mode && b.caso == r.caso; });
+        if (it == base.end()) {
+            cout << left << setw(28) << to_string(r.mode) << setw(24) << r.caso << "sin línea base\n";
+            continue;
+        }
+        if (it->solved && !r.solved) {
+            ++regresiones;
+            cout << left << setw(28) << to_string(r.mode) << setw(24) << r.caso << termcolor::red
+                 << "REGRESIÓN: la línea base resolvía este caso" << termcolor::reset << "\n";
+        }
+
+        for (int fase = 0; fase < NUM_PHASES; ++fase) {
+            const vector<double>& actual = r.muestras[fase];
+            const vector<double>& anterior = it->muestras[fase];
+            if (actual.empty() || anterior.empty()) { continue; }
+
+            double mediaBase = media(anterior);
+            double diferencia = media(actual) - mediaBase;
+            double varActual = pow(desviacion(actual), 2) / actual.size();
+            double varBase = pow(desviacion(anterior), 2) / anterior.size();
+            double error = sqrt(varActual + varBase);
+            double margen = 0.0;
+            if (error > 0.0) {
+                // Grados de libertad de Welch-Satterthwaite (las fases con una sola muestra no aportan varianza)
+                double denominador = 0.0;
+                if (actual.size() > 1) { denominador += varActual * varActual / (actual.size() - 1); }
+                if (anterior.size() > 1) { denominador += varBase * varBase / (anterior.size() - 1); }
+                double df = (denominador > 0.0) ? pow(varActual + varBase, 2) / denominador : 1.0;
+                margen = tStudent(df) * error;
+            }
+            double inferior = diferencia - margen;
+            double superior = diferencia + margen;
+            double umbral = max(tolerancia * mediaBase, RUIDO_MINIMO_MS);
+
+            bool regresion = inferior > umbral;
+            bool mejora = superior < -umbral;
+            if (regresion) { ++regresiones; }
+
+            stringstream intervalo;
+            intervalo << fixed << setprecision(4) << "[" << inferior << ", " << superior << "]";
+            cout << left << setw(28) << (fase == 0 ? to_string(r.mode) : "") << setw(24) << (fase == 0 ? r.caso : "")
+                 << setw(8) << PHASE_NAMES[fase] << right << fixed << setprecision(4)
+                 << setw(12) << mediaBase << setw(12) << media(actual)
+                 << setw(9) << setprecision(1) << (mediaBase > 0.0 ? 100.0 * diferencia / mediaBase : 0.0) << "%"
+                 << setw(26) << intervalo.str() << "  ";
+            if (regresion) { cout << termcolor::red << "REGRESIÓN" << termcolor::reset; }
+            else if (mejora) { cout << termcolor::green << "mejora" << termcolor::reset; }
+            else { cout << "="; }
+            cout << "\n";
+            cout.unsetf(ios::fixed);
+            cout << setprecision(6);
+        }
+    }
+    return regresiones;
+}
+
+int main(int argc, char** argv) {
+    vector<MODES> modos;
+    int calentamiento = WARMUP;
+    int repeticiones = REPETICIONES;
+    bool todos = false;
+    bool leerContadores = false;
+    string archivoJSON, archivoTabla, archivoBase, archivoTraza;
+    double tolerancia = TOLERANCIA;
+    long long limiteMs = 0, limiteNodos = 0;
+    vector<string> archivos;
+
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "-m" && i + 1 < argc) {
+            stringstream lista(argv[++i]);
+            string modo;
+            while (getline(lista, modo, ',')) {
+                int m = atoi(modo.c_str());
+                modos.push_back(m == 9 ? MODES::AUTO : static_cast<MODES>(m));
+            }
+        } else if (arg == "-w" && i + 1 < argc) {
+            calentamiento = max(0, atoi(argv[++i]));
+        } else if (arg == "-r" && i + 1 < argc) {
+            repeticiones = max(1, atoi(argv[++i]));
+        } else if (arg == "-a") {
+            todos = true;
+        } else if (arg == "-p") {
+            leerContadores = true;
+        } else if (arg == "-j" && i + 1 < argc) {
+            archivoJSON = argv[++i];
+        } else if (arg == "-d" && i + 1 < argc) {
+            archivoTabla = argv[++i];
+        } else if (arg == "-c" && i + 1 < argc) {
+            archivoBase = argv[++i];
+        } else if (arg == "-t" && i + 1 < argc) {
+            archivoTraza = argv[++i];
+        } else if (arg == "-l" && i + 1 < argc) {
+            limiteMs = max(0LL, atoll(argv[++i]));
+        } else if (arg == "-n" && i + 1 < argc) {
+            limiteNodos = max(0LL, atoll(argv[++i]));
+        } else if (arg == "-u" && i + 1 < argc) {
+            tolerancia = max(0.0, atof(argv[++i]));
+        } else if (arg[0] == '-') {
+            mostrarUso();
+            return -1;
+        } else {
+            archivos.push_back(arg);
+        }
+    }
+    if (modos.empty()) {
+        for (int m = 0; m <= static_cast<int>(MODES::AUTO); ++m) { modos.push_back(static_cast<MODES>(m)); }
+    }
+    if (archivos.empty()) {
+        for (string tamano : { "9x9_", "16x16_", "25x25_" }) {
+            for (string dificultad : { "easy", "medium", "hard" }) {
+                archivos.push_back("..\\Test_Cases\\" + tamano + dificultad + ".txt");
+            }
+        }
+    }
+
+    // La línea base se lee antes de medir para no perder la ejecución si el archivo no es válido
+    vector<Resultado> base;
+    if (!archivoBase.empty() && !leerJSON(archivoBase, base)) {
+        cerr << termcolor::red << "Error leyendo la línea base " << archivoBase << termcolor::reset << "\n";
+        return -1;
+    }
+
+    // Los contadores se abren antes de la primera región paralela para que los hilos de OpenMP los hereden
+    unique_ptr<PerfCounters> contadores;
+    if (leerContadores) {
+        contadores.reset(new PerfCounters());
+        if (!contadores->is_available()) {
+            cerr << termcolor::yellow << "Contadores hardware no disponibles (perf_event_open): se mide solo el tiempo"
+                 << termcolor::reset << "\n";
+            contadores.reset();
+        }
+    }
+
+    vector<Resultado> resultados;
+    SolverDispatchTable tabla;
+    ParallelTrace traza;
+    for (const string& archivo : archivos) {
+        if (!ifstream(archivo).good()) {
+            cerr << termcolor::yellow << "Se omite " << archivo << ": no existe" << termcolor::reset << "\n";
+            continue;
+        }
+        SudokuBoard board(archivo, false);
+        PuzzleFeatures features = compute_features(board);
+        string caso = archivo.substr(archivo.find_last_of("/\\") + 1);
+
+        for (MODES mode : modos) {
+            if (!todos && board.get_board_size() > tamanoMaximo(mode)) { continue; }
+            cout << "Midiendo " << to_string(mode) << " sobre " << caso << "..." << endl;
+
+            Resultado resultado;
+            resultado.mode = mode;
+            resultado.caso = caso;
+            resultado.board_size = board.get_board_size();
+            for (int i = 0; i < calentamiento; ++i) { ejecutar(archivo, resultado, false, contadores.get(), limiteMs, limiteNodos); }
+            for (int i = 0; i < repeticiones; ++i) {
+                if (!archivoTraza.empty() && i == repeticiones - 1) { traza.start(); }
+                ejecutar(archivo, resultado, true, contadores.get(), limiteMs, limiteNodos);
+                traza.stop();
+            }
+
+            if (resultado.solved && mode != MODES::AUTO) {
+                tabla.record(features, mode, percentil(resultado.muestras[SETUP], 50) + percentil(resultado.muestras[SOLVE], 50));
+            }
+            resultados.push_back(resultado);
+        }
+    }
+
+    cout << "\n";
+    imprimirTabla(resultados);
+
+    if (!archivoJSON.empty() && !escribirJSON(resultados, archivoJSON, calentamiento, repeticiones)) {
+        cerr << termcolor::red << "Error escribiendo " << archivoJSON << termcolor::reset << "\n";
+        return -1;
+    }
+    if (!archivoTraza.empty()) {
+        if (!traza.save(archivoTraza)) {
+            cerr << termcolor::red << "Error escribiendo " << archivoTraza << termcolor::reset << "\n";
+            return -1;
+        }
+        cout << "Traza (" << traza.size() << " eventos) guardada en " << archivoTraza << "\n";
+    }
+    if (!archivoTabla.empty()) {
+        tabla.learn();
+        if (!tabla.save(archivoTabla)) {
+            cerr << termcolor::red << "Error escribiendo " << archivoTabla << termcolor::reset << "\n";
+            return -1;
+        }
+        cout << "Tabla de despacho (" << tabla.size() << " reglas) guardada en " << archivoTabla << "\n";
+    }
+    if (!archivoBase.empty()) {
+        cout << "\nComparación con " << archivoBase << " (tolerancia " << 100.0 * tolerancia << "%):\n";
+        int regresiones = compararConBase(resultados, base, tolerancia);
+        if (regresiones > 0) {
+            cout << termcolor::red << regresiones << " regresiones" << termcolor::reset << "\n";
+            return 1;
+        }
+        cout << termcolor::green << "Sin regresiones" << termcolor::reset << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,185 @@
+#include "SudokuBoard.hpp"
+#include "SudokuSolutionEnumerator.hpp"
+#include "termcolor.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define INTERVALO_CHECKPOINT_MS 5000   // Tiempo entre dos guardados del punto de control
+
+using namespace std;
+
+// Enumera las soluciones de un sudoku con uno de los enumeradores perezosos y permite interrumpir la búsqueda
+// y retomarla desde un punto de control. Cada solución se escribe en una línea "k: v1 v2 ... vN²" (k empieza
+// en 1 y sigue contando al retomar), así que la salida de varias ejecuciones se puede comparar directamente.
+//   - --checkpoint archivo: guarda el estado cada -i ms mientras busca y otra vez al terminar (también al
+//     llegar al máximo de -n, para seguir después).
+//   - --resume: retoma la búsqueda guardada en el archivo de --checkpoint antes de seguir enumerando.
+//   - --verify: comprueba el ciclo guardar/interrumpir/retomar contra una enumeración completa, sin escribir
+//     soluciones (usa el archivo de --checkpoint o uno temporal).
+//
+// Uso: EnumerateSolutions [-m dlx|bits] [-n max] [-i ms] [--checkpoint archivo] [--resume] [--verify] sudoku.txt
+
+struct Opciones {
+    string motor = "dlx";                       // Enumerador: "dlx" o "bits"
+    long long maximo = 0;                       // Soluciones por ejecución (0 = todas)
+    int intervalo = INTERVALO_CHECKPOINT_MS;    // Intervalo del guardado periódico
+    string checkpoint;                          // Archivo del punto de control ("" = sin guardar)
+    bool retomar = false;                       // Retomar desde el punto de control
+    bool verificar = false;                     // Comprobar guardar/interrumpir/retomar
+};
+
+void mostrarUso() {
+    cerr << "Uso: EnumerateSolutions [-m dlx|bits] [-n max] [-i ms] [--checkpoint archivo] [--resume] [--verify] sudoku.txt\n";
+    cerr << "    -m: enumerador (dlx por defecto; bits = backtracking con máscaras de bits)\n";
+    cerr << "    -n: máximo de soluciones en esta ejecución (por defecto 0 = todas)\n";
+    cerr << "    -i: ms entre dos guardados del punto de control (por defecto " << INTERVALO_CHECKPOINT_MS << ")\n";
+    cerr << "    --checkpoint: archivo del punto de control; se guarda periódicamente y al terminar\n";
+    cerr << "    --resume: retoma la búsqueda guardada en el archivo de --checkpoint\n";
+    cerr << "    --verify: comprueba que al retomar salen las mismas soluciones que sin interrumpir\n";
+}
+
+// Una solución en una línea, con los valores separados por espacios
+string linea(const SudokuBoard& board) {
+    string texto;
+    for (int cell = 0; cell < board.get_num_total_cells(); ++cell) {
+        if (cell > 0) { texto += ' '; }
+        texto += to_string(board.at(cell));
+    }
+    return texto;
+}
+
+template <class Enumerador>
+int enumerar(const SudokuBoard& board, const Opciones& opciones) {
+    Enumerador enumerador(board);
+    if (opciones.retomar) {
+        if (!enumerador.load_checkpoint(opciones.checkpoint)) {
+            cerr << termcolor::red << "No se pudo retomar desde " << opciones.checkpoint
+                 << " (no existe, está dañado o es de otro sudoku o enumerador)" << termcolor::reset << "\n";
+            return -1;
+        }
+        cerr << "Retomando tras " << enumerador.get_num_solutions() << " soluciones\n";
+    }
+    if (!opciones.checkpoint.empty()) { enumerador.set_checkpoint(opciones.checkpoint, opciones.intervalo); }
+
+    long long limite = (opciones.maximo > 0) ? enumerador.get_num_solutions() + opciones.maximo : -1;
+    while ((limite < 0 || enumerador.get_num_solutions() < limite) && enumerador.next()) {
+        cout << enumerador.get_num_solutions() << ": " << linea(enumerador.solution()) << "\n";
+    }
+
+    if (!opciones.checkpoint.empty() && !enumerador.save_checkpoint(opciones.checkpoint)) {
+        cerr << termcolor::red << "Error guardando " << opciones.checkpoint << termcolor::reset << "\n";
+        return -1;
+    }
+    cerr << enumerador.get_num_solutions() << " soluciones en total\n";
+    return 0;
+}
+
+// Retoma desde el archivo y compara las soluciones que quedan con las de la referencia (la enumeración
+// completa); escribe el resultado y devuelve si coinciden. Sin archivo no hay nada que comparar
+template <class Enumerador>
+bool compararRetomada(const SudokuBoard& board, const string& archivo, const vector<string>& referencia,
+                      const string& caso) {
+    Enumerador enumerador(board);
+    if (!enumerador.load_checkpoint(archivo)) {
+        cerr << caso << ": la búsqueda terminó antes del primer guardado\n";
+        return true;
+    }
+    long long inicio = enumerador.get_num_solutions();
+    long long k = inicio;
+    bool iguales = (inicio <= (long long)referencia.size());
+    while (iguales && k < (long long)referencia.size() && enumerador.next()) {
+        iguales = (linea(enumerador.solution()) == referencia[k++]);
+    }
+    iguales = iguales && k == (long long)referencia.size();
+    cerr << (iguales ? termcolor::green : termcolor::red) << caso << ": retomada tras " << inicio << " soluciones, "
+         << (iguales ? "mismas soluciones restantes" : "las soluciones restantes no coinciden") << termcolor::reset << "\n";
+    return iguales;
+}
+
+// Enumera la referencia completa (hasta el máximo) y la compara con dos búsquedas interrumpidas a la mitad:
+// una guardada entre dos soluciones y otra que solo deja el guardado periódico y se abandona sin guardar al
+// final, como si el proceso muriera en mitad de la búsqueda
+template <class Enumerador>
+int verificar(const SudokuBoard& board, const Opciones& opciones) {
+    string archivo = opciones.checkpoint.empty() ? "enumerate_verify.ckpt" : opciones.checkpoint;
+
+    vector<string> referencia;
+    {
+        Enumerador enumerador(board);
+        while ((opciones.maximo <= 0 || (long long)referencia.size() < opciones.maximo) && enumerador.next()) {
+            referencia.push_back(linea(enumerador.solution()));
+        }
+    }
+    cerr << referencia.size() << " soluciones de referencia\n";
+    size_t mitad = referencia.size() / 2;
+
+    bool correcto = true;
+    {
+        Enumerador enumerador(board);
+        for (size_t i = 0; i < mitad && enumerador.next(); ++i) {}
+        if (!enumerador.save_checkpoint(archivo)) {
+            cerr << termcolor::red << "Error guardando " << archivo << termcolor::reset << "\n";
+            return -1;
+        }
+    }
+    correcto = compararRetomada<Enumerador>(board, archivo, referencia, "entre soluciones") && correcto;
+
+    remove(archivo.c_str());
+    {
+        Enumerador enumerador(board);
+        enumerador.set_checkpoint(archivo, 0);   // Guarda en cada consulta del reloj
+        for (size_t i = 0; i < mitad && enumerador.next(); ++i) {}
+    }
+    correcto = compararRetomada<Enumerador>(board, archivo, referencia, "guardado periódico") && correcto;
+
+    if (opciones.checkpoint.empty()) { remove(archivo.c_str()); }
+    return correcto ? 0 : 1;
+}
+
+template <class Enumerador>
+int ejecutar(const SudokuBoard& board, const Opciones& opciones) {
+    return opciones.verificar ? verificar<Enumerador>(board, opciones) : enumerar<Enumerador>(board, opciones);
+}
+
+int main(int argc, char** argv) {
+    Opciones opciones;
+    string archivo;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "-m" && i + 1 < argc) {
+            opciones.motor = argv[++i];
+        } else if (arg == "-n" && i + 1 < argc) {
+            opciones.maximo = max(0LL, atoll(argv[++i]));
+        } else if (arg == "-i" && i + 1 < argc) {
+            opciones.intervalo = max(0, atoi(argv[++i]));
+        } else if (arg == "--checkpoint" && i + 1 < argc) {
+            opciones.checkpoint = argv[++i];
+        } else if (arg == "--resume") {
+            opciones.retomar = true;
+        } else if (arg == "--verify") {
+            opciones.verificar = true;
+        } else if (arg[0] == '-' || !archivo.empty()) {
+            mostrarUso();
+            return -1;
+        } else {
+            archivo = arg;
+        }
+    }
+    if (archivo.empty() || (opciones.motor != "dlx" && opciones.motor != "bits")
+        || (opciones.retomar && opciones.checkpoint.empty())) {
+        mostrarUso();
+        return -1;
+    }
+
+    SudokuBoard board(archivo, false);
+    if (board.get_board_size() <= 0) {
+        cerr << termcolor::red << archivo << " no contiene un sudoku" << termcolor::reset << "\n";
+        return -1;
+    }
+    if (opciones.motor == "bits") { return ejecutar<BitBoardSolutionEnumerator>(board, opciones); }
+    return ejecutar<DLXSolutionEnumerator>(board, opciones);
+}
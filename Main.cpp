@@ -1,12 +1,10 @@
 #include "SudokuBoard.hpp"
 #include "SudokuTest.hpp"
 #include "SudokuSolver.hpp"
-#include "SudokuSolver_SequentialBacktracking.hpp"
-#include "SudokuSolver_SequentialBruteForce.hpp"
-#include "SudokuSolver_ParallelBruteForce.hpp"
-#include "SudokuSolver_SequentialDLX.hpp"
-#include "SudokuSolver_ParallelDLX.hpp"
-#include "SudokuSolver_SequentialForwardChecking.hpp"
+#include "SudokuSolverFactory.hpp"
+#include "SudokuGenerator.hpp"
+#include "SudokuMinimizer.hpp"
+#include "SudokuGrader.hpp"
 
 
 #include "termcolor.hpp"
@@ -29,6 +27,57 @@ void mostrarMenu() {
     cout << "3: modo secuencial con algoritmo DLX\n";
     cout << "4: modo paralelo con algoritmo DLX\n";
     cout << "5: modo secuencial con algoritmo de chequeo hacia adelante\n";
+    cout << "6: modo secuencial con backtracking sobre mascaras de bits\n";
+    cout << "7: generar sudokus con solucion unica (en paralelo)\n";
+    cout << "8: minimizar las pistas de un sudoku (en paralelo)\n";
+    cout << "9: modo automatico (elige el algoritmo segun el sudoku)\n";
+}
+
+// Función para generar sudokus en paralelo y mostrar cuántos sudokus por segundo se generan
+void generarSudokus() {
+    int tamano, pistas, simetria, cantidad;
+
+    cout << "Selecciona el tamaño del Sudoku:\n";
+    cout << "1: 9x9\n";
+    cout << "2: 16x16\n";
+    cout << "3: 25x25\n";
+    cout << "Selecciona una opción: ";
+    cin >> tamano;
+
+    cout << "Número de pistas objetivo (0 = mínimo posible): ";
+    cin >> pistas;
+
+    cout << "Selecciona la simetría de las pistas:\n";
+    cout << "0: sin simetría\n";
+    cout << "1: rotación de 180 grados\n";
+    cout << "2: espejo vertical\n";
+    cout << "3: diagonal\n";
+    cout << "Selecciona una opción: ";
+    cin >> simetria;
+
+    cout << "Cantidad de sudokus a generar: ";
+    cin >> cantidad;
+    if (cantidad <= 0) { return; }
+
+    GeneratorOptions options;
+    options.box_size = (tamano == 2) ? 4 : (tamano == 3) ? 5 : 3;
+    options.target_clues = pistas;
+    options.symmetry = (simetria >= 0 && simetria <= 3) ? static_cast<SYMMETRY>(simetria) : SYMMETRY::NONE;
+    options.seed = random_device()();
+
+    SudokuGenerator generator(options);
+    auto start = chrono::steady_clock::now();
+    vector<SudokuBoard> puzzles = generator.generate_batch(cantidad);
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    int N = options.box_size * options.box_size;
+    for (int i = 0; i < cantidad; ++i) {
+        write_input(puzzles[i], "generado_" + to_string(N) + "x" + to_string(N) + "_" + to_string(i) + ".txt");
+    }
+
+    cout << termcolor::green << cantidad << " sudokus de " << N << "x" << N << " generados en " << seconds << " s ("
+         << cantidad / seconds << " sudokus/s con " << omp_get_max_threads() << " hilos)\n" << termcolor::reset;
+    cout << puzzles[0];
 }
 
 // Función para mostrar el submenú de selección de tamaño y dificultad
@@ -73,37 +122,29 @@ bool archivoExiste(const string& nombreArchivo) {
     return archivo.good();
 }
 
-unique_ptr<SudokuSolver> CreateSudokuSolver(MODES mode, SudokuBoard& board) {
-    switch (mode) {
-        case MODES::SEQUENTIAL_BACKTRACKING:
-            return make_unique<SudokuSolver_SequentialBacktracking>(board);
-            
-        case MODES::SEQUENTIAL_BRUTEFORCE:
-            return make_unique<SudokuSolver_SequentialBruteForce>(board);
-        
-        case MODES::PARALLEL_BRUTEFORCE:
-            return std::make_unique<SudokuSolver_ParallelBruteForce>(board);
-       
-        case MODES::SEQUENTIAL_DANCINGLINKS:
-            return std::make_unique<SudokuSolver_SequentialDLX>(board);
-
-		case MODES::PARALLEL_DANCINGLINKS:
-            return std::make_unique<SudokuSolver_ParallelDLX>(board);
- 
-		case MODES::SEQUENTIAL_FORWARDCHECKING:
-            return std::make_unique<SudokuSolver_SequentialForwardChecking>(board);
-		default:
-            cerr << termcolor::red << "Available options for <MODE>: " << "\n";
-            cerr << "    - 0: sequential mode with backtracking algorithm" << "\n";
-            cerr << "	 - 1: sequential mode with brute force algorithm" << "\n";
-            cerr << "	 - 2: parallel mode with brute force algorithm" << "\n";
-			cerr << "		- 3: sequential mode with DLX algorithm" << "\n";
-			cerr << "		- 4: parallel mode with DLX algorithm" << "\n";
-			cerr << "		- 5: sequential mode with forward checking algorithm" << "\n";
-			cerr << "Please try again." << termcolor::reset << "\n";
-			
-            exit(-1);
+// Función para reducir un sudoku a un sudoku mínimo y guardarlo en minimizado.txt
+void minimizarSudoku() {
+    string archivo = seleccionarCaso();
+    if (!archivoExiste(archivo)) {
+        cout << termcolor::red << "Error abriendo el archivo: " << archivo << "\n" << termcolor::reset;
+        return;
+    }
+
+    auto board = SudokuBoard(archivo);
+    SudokuBoard minimal;
+    auto start = chrono::steady_clock::now();
+    if (!SudokuMinimizer().minimize(board, minimal)) {
+        cout << termcolor::red << "El sudoku no es válido o no tiene solución única.\n" << termcolor::reset;
+        return;
     }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    int pistasIniciales = board.get_num_total_cells() - board.get_num_empty_cells();
+    int pistasFinales = minimal.get_num_total_cells() - minimal.get_num_empty_cells();
+    cout << termcolor::green << "Sudoku mínimo: " << pistasIniciales << " -> " << pistasFinales << " pistas en "
+         << seconds << " s\n" << termcolor::reset;
+    cout << minimal;
+    write_input(minimal, "minimizado.txt");
 }
 
 int main() {
@@ -128,7 +169,11 @@ int main() {
         mostrarMenu();
        cout << "Selecciona una opción: ";
 cin >> choice;
- if (choice >= 0 && choice <= 5) {  // Maneja todas las opciones entre 0 y 5
+ if (choice == 7) {
+            generarSudokus();
+        } else if (choice == 8) {
+            minimizarSudoku();
+        } else if ((choice >= 0 && choice <= 6) || choice == 9) {  // Maneja las opciones de resolución (0 a 6 y automático)
             string archivo = seleccionarCaso();  // Selección del archivo
             cout << "Intentando abrir el archivo: " << archivo << endl;
             cout << "Ruta completa del archivo: " << archivo << endl;
@@ -141,9 +186,18 @@ cin >> choice;
             auto board = SudokuBoard(archivo);  // Carga el archivo seleccionado
             SudokuTest::testBoard(board);
 
-            MODES mode = static_cast<MODES>(choice);  // Asignar modo basado en opción elegida
+            // Calificación rápida por técnicas (sin el solucionador de referencia, para no retrasar tableros grandes)
+            GradeReport grado = SudokuGrader().grade(board);
+            cout << "Dificultad: " << grado.difficulty() << " (técnica más difícil: " << to_string(grado.hardest) << ")\n";
+
+            MODES mode = (choice == 9) ? MODES::AUTO : static_cast<MODES>(choice);  // Asignar modo basado en opción elegida
             auto solver = CreateSudokuSolver(mode, board);
+            auto inicio = chrono::steady_clock::now();
             solver->solve();
+#if PRINT_TIME
+            double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count();
+            cout << "\nTiempo de resolución: " << ms << " ms\n";
+#endif
 
             if (solver->get_status()) {
                 cout << termcolor::green << "Sudoku resuelto exitosamente:\n" << termcolor::reset;
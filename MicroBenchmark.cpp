@@ -0,0 +1,207 @@
+#include "SudokuBoard.hpp"
+#include "SudokuSolver.hpp"
+#include "SudokuSolver_SequentialBacktracking.hpp"
+#include "SudokuSolver_SequentialForwardChecking.hpp"
+#include "SudokuGenerator.hpp"
+#include "SudokuUniqueness.hpp"
+#include "DLXTemplate.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#define TIEMPO_MINIMO_MS 200       // Tiempo mínimo medido por primitiva (se duplican las iteraciones hasta alcanzarlo)
+#define MAX_ITERACIONES (1 << 24)  // Tope de iteraciones por primitiva
+#define SEMILLA 12345              // Semilla fija: los tableros de entrada son siempre los mismos
+#define PORCENTAJE_VACIAS 55       // Celdas que se vacían de la cuadrícula completa
+
+using namespace std;
+
+// Microbenchmarks de las primitivas que dominan los perfiles de los solucionadores.
+// Cada primitiva se mide aislada sobre tableros fijos de 9x9, 16x16 y 25x25, y se informa del tiempo por
+// operación (ns/op) y de las reservas de memoria por operación (allocs/op, contando las llamadas a operator new).
+//
+// Uso: MicroBenchmark [-f filtro] [-t ms]
+
+// Contador de reservas de memoria: se sustituye el operator new global de este ejecutable
+static long long g_reservas = 0;
+
+void* operator new(size_t size) {
+    ++g_reservas;
+    void* p = malloc(size ? size : 1);
+    if (p == nullptr) { throw bad_alloc(); }
+    return p;
+}
+void* operator new[](size_t size) { return operator new(size); }
+void operator delete(void* p) noexcept { free(p); }
+void operator delete[](void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+void operator delete[](void* p, size_t) noexcept { free(p); }
+
+// Evita que el compilador elimine el trabajo medido
+static volatile long long g_sumidero = 0;
+
+struct Medida {
+    double ns_op;
+    double allocs_op;
+    long long iteraciones;
+};
+
+// Mide op(i) duplicando las iteraciones hasta superar el tiempo mínimo.
+// preparar(n) se llama antes de cada intento, fuera de la zona medida, para primitivas que modifican su entrada.
+template <class Preparar, class Operacion>
+Medida medir(double tiempoMinimoMs, long long maxIteraciones, Preparar preparar, Operacion op) {
+    long long iteraciones = 1;
+    while (true) {
+        preparar(iteraciones);
+        long long reservas = g_reservas;
+        auto inicio = chrono::steady_clock::now();
+        for (long long i = 0; i < iteraciones; ++i) { op(i); }
+        double ns = chrono::duration<double, nano>(chrono::steady_clock::now() - inicio).count();
+        reservas = g_reservas - reservas;
+
+        if (ns >= tiempoMinimoMs * 1e6 || iteraciones >= maxIteraciones) {
+            return { ns / iteraciones, double(reservas) / iteraciones, iteraciones };
+        }
+        iteraciones *= 2;
+    }
+}
+
+template <class Operacion>
+Medida medir(double tiempoMinimoMs, Operacion op) {
+    return medir(tiempoMinimoMs, MAX_ITERACIONES, [](long long) {}, op);
+}
+
+// Tablero fijo: cuadrícula completa aleatoria (semilla fija) con PORCENTAJE_VACIAS % de celdas vaciadas
+SudokuBoard tableroFijo(int box_size) {
+    mt19937 rng(SEMILLA + box_size);
+    Board grid = SudokuGenerator::random_full_grid(box_size, rng);
+    for (auto& fila : grid) {
+        for (int& celda : fila) {
+            if (int(rng() % 100) < PORCENTAJE_VACIAS) { celda = 0; }
+        }
+    }
+    return SudokuBoard(grid);
+}
+
+void imprimir(const string& primitiva, int N, const Medida& m) {
+    cout << left << setw(36) << primitiva << setw(8) << (to_string(N) + "x" + to_string(N))
+         << right << fixed << setprecision(1) << setw(14) << m.ns_op << setprecision(2) << setw(12) << m.allocs_op
+         << setw(14) << m.iteraciones << "\n";
+}
+
+int main(int argc, char** argv) {
+    string filtro;
+    double tiempoMinimoMs = TIEMPO_MINIMO_MS;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "-f" && i + 1 < argc) {
+            filtro = argv[++i];
+        } else if (arg == "-t" && i + 1 < argc) {
+            tiempoMinimoMs = max(1.0, atof(argv[++i]));
+        } else {
+            cerr << "Uso: MicroBenchmark [-f filtro] [-t ms]\n";
+            cerr << "    -f: solo las primitivas cuyo nombre contiene el filtro\n";
+            cerr << "    -t: tiempo mínimo medido por primitiva en ms (por defecto " << TIEMPO_MINIMO_MS << ")\n";
+            return -1;
+        }
+    }
+    auto activa = [&](const string& nombre) { return filtro.empty() || nombre.find(filtro) != string::npos; };
+
+    cout << left << setw(36) << "primitiva" << setw(8) << "tamaño" << right << setw(14) << "ns/op"
+         << setw(12) << "allocs/op" << setw(14) << "iteraciones" << "\n";
+    cout << string(84, '-') << "\n";
+
+    for (int box_size : { 3, 4, 5 }) {
+        SudokuBoard board = tableroFijo(box_size);
+        const int N = board.get_board_size();
+        const int celdas = N * N;
+        SudokuSolver_SequentialBacktracking solver(board, false);   // Da acceso a las primitivas de SudokuSolver
+
+        if (activa("SudokuSolver::isValid")) {
+            imprimir("SudokuSolver::isValid", N, medir(tiempoMinimoMs, [&](long long i) {
+                Position pos(int(i % celdas) / N, int(i % celdas) % N);
+                g_sumidero += solver.isValid(board, int(i % N) + 1, pos);
+            }));
+        }
+
+        if (activa("SudokuSolver::isUnique")) {
+            imprimir("SudokuSolver::isUnique", N, medir(tiempoMinimoMs, [&](long long i) {
+                Position pos(int(i % celdas) / N, int(i % celdas) % N);
+                g_sumidero += solver.isUnique(board, int(i % N) + 1, pos);
+            }));
+        }
+
+        if (activa("SudokuSolver::find_empty")) {
+            imprimir("SudokuSolver::find_empty", N, medir(tiempoMinimoMs, [&](long long) {
+                g_sumidero += solver.find_empty(board).first;
+            }));
+        }
+
+        // ColumnNode ya no existe: la cobertura de columnas se hace sobre DLXInstance
+        if (activa("DLXInstance::cover+uncover")) {
+            DLXInstance dlx;
+            dlx.reset(DLXTemplate::get(N));
+            dlx.coverGivens(board);
+            vector<int> columnas;
+            for (int c = dlx.right(dlx.header()); c != dlx.header(); c = dlx.right(c)) { columnas.push_back(c); }
+            imprimir("DLXInstance::cover+uncover", N, medir(tiempoMinimoMs, [&](long long i) {
+                int c = columnas[i % columnas.size()];
+                dlx.cover(c);
+                dlx.uncover(c);
+            }));
+        }
+
+        if (activa("ForwardChecking::propagate_step")) {
+            SudokuSolver_SequentialForwardChecking fc(board, false);
+            StateMatrix estado;
+            board.createStateMatrix(estado);
+            board.convertToStateMatrix(estado);
+            vector<StateMatrix> copias;   // propagate_step modifica el estado: una copia nueva por operación
+            imprimir("ForwardChecking::propagate_step", N, medir(tiempoMinimoMs, 1 << 12,
+                [&](long long n) { copias.assign(n, estado); },
+                [&](long long i) { g_sumidero += fc.propagate_step(copias[i]); }));
+        }
+
+        if (activa("SudokuBoard(const SudokuBoard&)")) {
+            imprimir("SudokuBoard(const SudokuBoard&)", N, medir(tiempoMinimoMs, [&](long long) {
+                SudokuBoard copia(board);
+                g_sumidero += copia.at(0, 0);
+            }));
+        }
+
+        if (activa("SudokuBoard::read_input")) {
+            string archivo = "microbenchmark_" + to_string(N) + ".txt";
+            write_input(board, archivo);
+            SudokuBoard lector;
+            imprimir("SudokuBoard::read_input", N, medir(tiempoMinimoMs, [&](long long) {
+                lector.read_input(archivo);
+                g_sumidero += lector.at(0, 0);
+            }));
+            remove(archivo.c_str());
+        }
+    }
+
+    // Comprobación de unicidad en 9x9 (un hilo): sobre el tablero fijo y sobre sudokus mínimos del generador,
+    // que son el caso caro (pocas pistas y ninguna poda hasta la segunda solución)
+    if (activa("has_unique_solution")) {
+        SudokuBoard board = tableroFijo(3);
+        imprimir("has_unique_solution", 9, medir(tiempoMinimoMs, [&](long long) {
+            g_sumidero += has_unique_solution(board);
+        }));
+
+        GeneratorOptions opciones;
+        opciones.box_size = 3;
+        opciones.seed = SEMILLA;
+        vector<SudokuBoard> minimos = SudokuGenerator(opciones).generate_batch(16, 1);
+        imprimir("has_unique_solution (pocas pistas)", 9, medir(tiempoMinimoMs, [&](long long i) {
+            g_sumidero += has_unique_solution(minimos[i % minimos.size()]);
+        }));
+    }
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include "SudokuBoard.hpp"
+#include "SudokuSolver.hpp"
+#include "SudokuSolver_ParallelBruteForce.hpp"
+#include "SudokuSolver_ParallelDLX.hpp"
+#include "SudokuSolverFactory.hpp"
+#include "SudokuParallelProfile.hpp"
+#include "termcolor.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <omp.h>
+#include <string>
+#include <vector>
+
+#define REPETICIONES 5       // Repeticiones por medida (se usa la mediana)
+#define LOTE_POR_HILO 4      // Escalado débil: sudokus del lote por cada hilo
+#define BRUTEFORCE_MAX_BOARD_SIZE 9   // La fuerza bruta es exponencial: solo se estudia hasta 9x9
+
+using namespace std;
+
+// Estudio de escalabilidad de los modos paralelos.
+//   - Escalado fuerte: el mismo sudoku con 1..N hilos; speedup = T(1) / T(p) y eficiencia = speedup / p.
+//   - Escalado débil: un lote de LOTE_POR_HILO * p copias del sudoku repartidas entre p hilos, cada copia con un
+//     solucionador de un hilo (el trabajo crece con los hilos y se mide el rendimiento del lote);
+//     eficiencia = T(1) / T(p), que idealmente se mantiene en 1.
+// Los resultados se escriben en CSV (una fila por estudio, modo, sudoku y número de hilos).
+//
+// Uso: ScalingStudy [-t hilos_max] [-r repeticiones] [-b lote_por_hilo] [-o salida.csv] sudoku1.txt ...
+
+// Modos paralelos que se estudian. Para añadir un motor paralelo nuevo basta con añadirlo aquí y en resolver()
+const MODES MODOS_PARALELOS[] = { MODES::PARALLEL_BRUTEFORCE, MODES::PARALLEL_DANCINGLINKS };
+
+void mostrarUso() {
+    cerr << "Uso: ScalingStudy [-t hilos_max] [-r repeticiones] [-b lote_por_hilo] [-o salida.csv] sudoku1.txt ...\n";
+    cerr << "    -t: número máximo de hilos (por defecto " << omp_get_num_procs() << ", los procesadores disponibles)\n";
+    cerr << "    -r: repeticiones por medida (por defecto " << REPETICIONES << ")\n";
+    cerr << "    -b: sudokus por hilo en el escalado débil (por defecto " << LOTE_POR_HILO << ")\n";
+    cerr << "    -o: archivo CSV (por defecto la salida estándar)\n";
+}
+
+// Resuelve el sudoku con el modo dado y hilos hilos (el resto de parámetros son los del perfil).
+// Devuelve false si no se encontró la solución.
+bool resolver(MODES mode, SudokuBoard& board, int hilos) {
+    ParallelConfig config = ParallelProfile::get().lookup(mode, board.get_board_size());
+    config.num_threads = hilos;
+    if (mode == MODES::PARALLEL_DANCINGLINKS) {
+        SudokuSolver_ParallelDLX solver(board, false);
+        solver.set_config(config);
+        solver.solve();
+        return solver.get_status();
+    }
+    SudokuSolver_ParallelBruteForce solver(board, false);
+    solver.set_config(config);
+    solver.solve();
+    return solver.get_status();
+}
+
+// Mediana del tiempo (ms) de resolver el sudoku con hilos hilos; negativo si falla
+double medir(MODES mode, SudokuBoard& board, int hilos, int repeticiones) {
+    vector<double> tiempos;
+    for (int r = 0; r < repeticiones; ++r) {
+        auto inicio = chrono::steady_clock::now();
+        if (!resolver(mode, board, hilos)) { return -1.0; }
+        tiempos.push_back(chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count());
+    }
+    sort(tiempos.begin(), tiempos.end());
+    return tiempos[tiempos.size() / 2];
+}
+
+// Mediana del tiempo (ms) de resolver lote copias del sudoku repartidas entre hilos hilos, cada una con un
+// solucionador de un hilo; negativo si alguna falla
+double medirLote(MODES mode, const SudokuBoard& board, int hilos, int lote, int repeticiones) {
+    vector<double> tiempos;
+    for (int r = 0; r < repeticiones; ++r) {
+        vector<SudokuBoard> copias(lote, board);   // Cada solucionador trabaja sobre su propia copia
+        int fallos = 0;
+        auto inicio = chrono::steady_clock::now();
+        #pragma omp parallel for schedule(dynamic, 1) num_threads(hilos) default(none) shared(copias, lote, mode) reduction(+:fallos)
+        for (int i = 0; i < lote; ++i) {
+            fallos += !resolver(mode, copias[i], 1);
+        }
+        tiempos.push_back(chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count());
+        if (fallos > 0) { return -1.0; }
+    }
+    sort(tiempos.begin(), tiempos.end());
+    return tiempos[tiempos.size() / 2];
+}
+
+int main(int argc, char** argv) {
+    int hilosMax = omp_get_num_procs();
+    int repeticiones = REPETICIONES;
+    int lotePorHilo = LOTE_POR_HILO;
+    string archivoCSV;
+    vector<string> archivos;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg == "-t" && i + 1 < argc) {
+            hilosMax = max(1, atoi(argv[++i]));
+        } else if (arg == "-r" && i + 1 < argc) {
+            repeticiones = max(1, atoi(argv[++i]));
+        } else if (arg == "-b" && i + 1 < argc) {
+            lotePorHilo = max(1, atoi(argv[++i]));
+        } else if (arg == "-o" && i + 1 < argc) {
+            archivoCSV = argv[++i];
+        } else if (arg[0] == '-') {
+            mostrarUso();
+            return -1;
+        } else {
+            archivos.push_back(arg);
+        }
+    }
+    if (archivos.empty()) {
+        mostrarUso();
+        return -1;
+    }
+
+    ofstream archivo;
+    if (!archivoCSV.empty()) {
+        archivo.open(archivoCSV);
+        if (!archivo.is_open()) {
+            cerr << termcolor::red << "Error abriendo " << archivoCSV << termcolor::reset << "\n";
+            return -1;
+        }
+    }
+    ostream& csv = archivoCSV.empty() ? cout : archivo;
+    csv << "study,mode,puzzle,threads,puzzles,median_ms,speedup,efficiency\n";
+
+    for (const string& nombre : archivos) {
+        SudokuBoard board(nombre, false);
+        string caso = nombre.substr(nombre.find_last_of("/\\") + 1);
+
+        for (MODES mode : MODOS_PARALELOS) {
+            if (mode == MODES::PARALLEL_BRUTEFORCE && board.get_board_size() > BRUTEFORCE_MAX_BOARD_SIZE) { continue; }
+            cerr << "Estudiando " << to_string(mode) << " sobre " << caso << "..." << endl;
+            resolver(mode, board, 1);   // Calentamiento (plantilla DLX, cachés)
+
+            double fuerte1 = 0.0, debil1 = 0.0;
+            for (int hilos = 1; hilos <= hilosMax; ++hilos) {
+                // Escalado fuerte: mismo sudoku, más hilos
+                double ms = medir(mode, board, hilos, repeticiones);
+                if (hilos == 1) { fuerte1 = ms; }
+                double speedup = (ms > 0.0 && fuerte1 > 0.0) ? fuerte1 / ms : 0.0;
+                csv << "strong," << to_string(mode) << "," << caso << "," << hilos << ",1," << ms << ","
+                    << speedup << "," << speedup / hilos << "\n";
+
+                // Escalado débil: lote proporcional a los hilos, un sudoku por hilo a la vez
+                int lote = lotePorHilo * hilos;
+                ms = medirLote(mode, board, hilos, lote, repeticiones);
+                if (hilos == 1) { debil1 = ms; }
+                double eficiencia = (ms > 0.0 && debil1 > 0.0) ? debil1 / ms : 0.0;
+                csv << "weak," << to_string(mode) << "," << caso << "," << hilos << "," << lote << "," << ms << ","
+                    << eficiencia * hilos << "," << eficiencia << "\n";
+            }
+        }
+    }
+    return 0;
+}